@@ -31,9 +31,11 @@ list (APPEND MAIN_SOURCE_FILES
       src/opm/common/OpmLog/StreamLog.cpp
       src/opm/common/OpmLog/TimerLog.cpp
       src/opm/common/utility/numeric/MonotCubicInterpolator.cpp
+      src/opm/common/utility/ActiveIndexMap.cpp
       src/opm/common/utility/parameters/Parameter.cpp
       src/opm/common/utility/parameters/ParameterGroup.cpp
       src/opm/common/utility/parameters/ParameterTools.cpp
+      src/opm/common/utility/numeric/calculateCellGeometry.cpp
       src/opm/common/utility/numeric/calculateCellVol.cpp
 )
 if(ENABLE_ECL_INPUT)
@@ -107,6 +109,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/parser/eclipse/EclipseState/Schedule/Well/WListManager.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/Well/WellEconProductionLimits.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/Well/WellInjectionProperties.cpp
+    src/opm/parser/eclipse/EclipseState/Schedule/Well/WellMatcher.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/Well/WellPolymerProperties.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTracerProperties.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/Well/WellProductionProperties.cpp
@@ -117,6 +120,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.cpp
     src/opm/parser/eclipse/EclipseState/Tables/ColumnSchema.cpp
     src/opm/parser/eclipse/EclipseState/Tables/JFunc.cpp
+    src/opm/parser/eclipse/EclipseState/Tables/PvtxEvaluator.cpp
     src/opm/parser/eclipse/EclipseState/Tables/PvtxTable.cpp
     src/opm/parser/eclipse/EclipseState/Tables/SimpleTable.cpp
     src/opm/parser/eclipse/EclipseState/Tables/PolyInjTables.cpp
@@ -139,6 +143,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQContext.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunction.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.cpp
+    src/opm/parser/eclipse/EclipseState/Schedule/VFPEvaluator.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/VFPInjTable.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.cpp
     src/opm/parser/eclipse/Parser/ErrorGuard.cpp
@@ -196,6 +201,7 @@ if(ENABLE_ECL_OUTPUT)
 endif()
 
 list (APPEND TEST_SOURCE_FILES
+      tests/test_ActiveIndexMap.cpp
       tests/test_calculateCellVol.cpp
       tests/test_cmp.cpp
       tests/test_cubic.cpp
@@ -267,6 +273,7 @@ if(ENABLE_ECL_INPUT)
     tests/parser/UDQTests.cpp
     tests/parser/UnitTests.cpp
     tests/parser/ValueTests.cpp
+    tests/parser/VFPEvaluatorTests.cpp
     tests/parser/WellSolventTests.cpp
     tests/parser/WellTracerTests.cpp
     tests/parser/WellTests.cpp
@@ -339,6 +346,11 @@ if(ENABLE_ECL_INPUT)
     examples/opmi.cpp
     examples/opmpack.cpp
     examples/opmhash.cpp
+    examples/gridpropertybench.cpp
+    examples/pvtxbench.cpp
+    examples/schedulebench.cpp
+    examples/vfpbench.cpp
+    examples/zcornbench.cpp
   )
 endif()
 
@@ -368,6 +380,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/OpmLog/OpmLog.hpp
       opm/common/OpmLog/StreamLog.hpp
       opm/common/OpmLog/TimerLog.hpp
+      opm/common/utility/ActiveIndexMap.hpp
       opm/common/utility/numeric/cmp.hpp
       opm/common/utility/platform_dependent/disable_warnings.h
       opm/common/utility/platform_dependent/reenable_warnings.h
@@ -386,6 +399,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/parameters/ParameterRequirement.hpp
       opm/common/utility/parameters/ParameterStrings.hpp
       opm/common/utility/parameters/ParameterTools.hpp
+      opm/common/utility/numeric/calculateCellGeometry.hpp
       opm/common/utility/numeric/calculateCellVol.hpp
 )
 if(ENABLE_ECL_INPUT)
@@ -466,6 +480,7 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/EclipseState/Tables/RocktabTable.hpp
        opm/parser/eclipse/EclipseState/Tables/EnkrvdTable.hpp
        opm/parser/eclipse/EclipseState/Tables/PlyrockTable.hpp
+       opm/parser/eclipse/EclipseState/Tables/PvtxEvaluator.hpp
        opm/parser/eclipse/EclipseState/Tables/PvtxTable.hpp
        opm/parser/eclipse/EclipseState/Tables/WatvisctTable.hpp
        opm/parser/eclipse/EclipseState/Tables/TableEnums.hpp
@@ -509,6 +524,7 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/EclipseState/Schedule/Action/ActionX.hpp
        opm/parser/eclipse/EclipseState/Schedule/ArrayDimChecker.hpp
        opm/parser/eclipse/EclipseState/Schedule/TimeMap.hpp
+       opm/parser/eclipse/EclipseState/Schedule/VFPEvaluator.hpp
        opm/parser/eclipse/EclipseState/Schedule/VFPInjTable.hpp
        opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.hpp
        opm/parser/eclipse/EclipseState/Schedule/Well/Connection.hpp
@@ -518,6 +534,7 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/EclipseState/Schedule/Well/WList.hpp
        opm/parser/eclipse/EclipseState/Schedule/Well/WListManager.hpp
        opm/parser/eclipse/EclipseState/Schedule/Well/WellEconProductionLimits.hpp
+       opm/parser/eclipse/EclipseState/Schedule/Well/WellMatcher.hpp
        opm/parser/eclipse/EclipseState/Schedule/Well/WellPolymerProperties.hpp
        opm/parser/eclipse/EclipseState/Schedule/Well/WellTracerProperties.hpp
        opm/parser/eclipse/EclipseState/Schedule/Well/WellTestConfig.hpp
@@ -0,0 +1,136 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/parser/eclipse/EclipseState/Eclipse3DProperties.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/GridProperty.hpp>
+
+/*
+  Benchmark for the grid property memory budget: an ENDSCALE deck is
+  created for a nx x ny x nz grid, and all the 34 saturation function
+  endpoint arrays are read twice. With a non zero budget (in MB) the
+  memory budget is enforced after each array has been read, i.e. the
+  way a simulator would do it when it is done with a property. The time
+  and the peak resident memory of the process are reported; run once
+  for each budget to compare the peaks.
+
+    gridpropertybench [budget_mb] [nx ny nz]
+*/
+
+namespace {
+
+const std::vector<std::string> endpoint_keywords = {
+    "SGL",  "ISGL",  "SGU",   "ISGU",   "SWL",   "ISWL",   "SWU",  "ISWU",
+    "SGCR", "ISGCR", "SOWCR", "ISOWCR", "SOGCR", "ISOGCR", "SWCR", "ISWCR",
+    "PCW",  "IPCW",  "PCG",   "IPCG",   "KRW",   "IKRW",   "KRWR", "IKRWR",
+    "KRO",  "IKRO",  "KRORW", "IKRORW", "KRORG", "IKRORG", "KRG",  "IKRG",
+    "KRGR", "IKRGR"
+};
+
+
+std::string endscaleDeck(std::size_t nx, std::size_t ny, std::size_t nz) {
+    const std::size_t num_cells = nx * ny * nz;
+    std::ostringstream deck;
+    deck << "RUNSPEC\nOIL\nGAS\nWATER\nMETRIC\nENDSCALE\n/\n"
+         << "DIMENS\n " << nx << " " << ny << " " << nz << " /\n"
+         << "TABDIMS\n 1 1 20 20 /\n"
+         << "GRID\n"
+         << "DX\n " << num_cells << "*10 /\n"
+         << "DY\n " << num_cells << "*10 /\n"
+         << "DZ\n " << num_cells << "*2 /\n"
+         << "TOPS\n " << nx * ny << "*1000 /\n"
+         << "PORO\n " << num_cells << "*0.2 /\n"
+         << "PERMX\n " << num_cells << "*100 /\n"
+         << "PROPS\n"
+         << "SWOF\n"
+         << " .2  .0 1.0 .4\n"
+         << " .3  .0  .8 .2\n"
+         << " .5  .5  .5 .1\n"
+         << " .8  .8  .0 .0\n"
+         << " 1.0 1.0 .0 .0 /\n"
+         << "SGOF\n"
+         << " .0  .0 1.0 .0\n"
+         << " .1  .0  .3 .1\n"
+         << " .5  .5  .1 .2\n"
+         << " .7  .8  .0 .3\n"
+         << " .8 1.0  .0 .4 /\n";
+    return deck.str();
+}
+
+
+double peakMemoryMB() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;   // ru_maxrss is in kB on Linux
+}
+
+}
+
+
+int main(int argc, char** argv) {
+    if (argc != 1 && argc != 2 && argc != 5) {
+        std::cerr << "usage: gridpropertybench [budget_mb] [nx ny nz]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::size_t budget_mb = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 0;
+    const std::size_t nx = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 200;
+    const std::size_t ny = (argc > 2) ? std::strtoul(argv[3], nullptr, 10) : 200;
+    const std::size_t nz = (argc > 2) ? std::strtoul(argv[4], nullptr, 10) : 10;
+    if (nx == 0 || ny == 0 || nz == 0) {
+        std::cerr << "usage: gridpropertybench [budget_mb] [nx ny nz] - all dimensions must be positive" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString( endscaleDeck(nx, ny, nz) );
+    Opm::EclipseState state( deck );
+    const auto& props = state.get3DProperties();
+    state.setMemoryBudget( budget_mb * 1024 * 1024 );
+    const double start_memory = peakMemoryMB();
+
+    double sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < 2; pass++) {
+        for (const auto& keyword : endpoint_keywords) {
+            const auto& data = props.getDoubleGridProperty( keyword ).getData();
+            sum += data[ data.size() / 2 ];
+            if (budget_mb > 0)
+                state.enforceMemoryBudget();
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    std::cout << "budget:        " << budget_mb << " MB" << std::endl;
+    std::cout << "time:          " << std::chrono::duration<double>(end - start).count() << " s" << std::endl;
+    std::cout << "peak memory:   " << peakMemoryMB() << " MB (" << start_memory << " MB before the endpoints were read)" << std::endl;
+    std::cout << "property data: " << props.memoryUsage() / (1024.0 * 1024.0) << " MB" << std::endl;
+    std::cout << "checksum:      " << sum << std::endl;
+}
@@ -0,0 +1,116 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/EclipseState/Tables/PvtxEvaluator.hpp>
+#include <opm/parser/eclipse/EclipseState/Tables/TableManager.hpp>
+
+/*
+  Micro benchmark for the PVTO evaluation: a PVTO table with 20 Rs
+  nodes and 10 undersaturated pressures for each node is evaluated for
+  a number of cells, with PvtxTable::evaluate() and with the compiled
+  PvtxEvaluator.
+
+    pvtxbench [num_cells] [repeat]
+*/
+
+namespace {
+
+std::string pvtoDeck() {
+    std::ostringstream deck;
+    deck << "RUNSPEC\nOIL\nGAS\nDISGAS\nMETRIC\nTABDIMS\n 1 1 20 20 /\nPROPS\nPVTO\n";
+    for (int node = 0; node < 20; node++) {
+        const double rs = 10 + 10 * node;
+        deck << rs;
+        for (int row = 0; row < 10; row++) {
+            const double p = 50 + 10 * node + 25 * row;
+            deck << " " << p << " " << 1.1 + 0.002 * node - 0.0002 * row << " " << 1.2 - 0.01 * node + 0.03 * row << "\n";
+        }
+        deck << "/\n";
+    }
+    deck << "/\n";
+    return deck.str();
+}
+
+
+template <typename Function>
+void timeit(const std::string& name, std::size_t num_evaluations, Function function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << name << ": " << 1e9 * seconds / num_evaluations << " ns/cell" << std::endl;
+}
+
+}
+
+
+int main(int argc, char** argv) {
+    const std::size_t num_cells = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    const std::size_t repeat = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 20;
+    if (num_cells == 0 || repeat == 0) {
+        std::cerr << "usage: pvtxbench [num_cells] [repeat] - both arguments must be positive" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(pvtoDeck());
+    const Opm::TableManager tables(deck);
+    const auto& table = tables.getPvtoTables()[0];
+    const Opm::PvtxEvaluator evaluator(table);
+
+    std::vector<double> rs(num_cells), pressure(num_cells);
+    for (std::size_t i = 0; i < num_cells; i++) {
+        rs[i] = 105 + 100 * std::sin(0.37 * i);
+        pressure[i] = 1e5 * (250 + 220 * std::cos(0.11 * i));
+    }
+
+    std::vector<double> fvf(num_cells), viscosity(num_cells);
+    double sum = 0;
+
+    timeit("PvtxTable    ", num_cells * repeat, [&]() {
+        for (std::size_t r = 0; r < repeat; r++)
+            for (std::size_t i = 0; i < num_cells; i++)
+                sum += table.evaluate("BO", rs[i], pressure[i]) + table.evaluate("MU", rs[i], pressure[i]);
+    });
+
+    timeit("PvtxEvaluator", num_cells * repeat, [&]() {
+        for (std::size_t r = 0; r < repeat; r++)
+            for (std::size_t i = 0; i < num_cells; i++)
+                sum += evaluator.evaluate(0, rs[i], pressure[i]) + evaluator.evaluate(1, rs[i], pressure[i]);
+    });
+
+    timeit("batch        ", num_cells * repeat, [&]() {
+        for (std::size_t r = 0; r < repeat; r++) {
+            evaluator.evaluate(num_cells, rs.data(), pressure.data(), fvf.data(), viscosity.data());
+            sum += fvf[r % num_cells] + viscosity[r % num_cells];
+        }
+    });
+
+    std::cout << "checksum: " << sum << std::endl;
+}
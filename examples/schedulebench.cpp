@@ -0,0 +1,104 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/EclipseState/Eclipse3DProperties.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/parser/eclipse/EclipseState/Runspec.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/EclipseState/Tables/TableManager.hpp>
+
+/*
+  Benchmark for the Schedule construction: a synthetic history deck
+  where every report step has a WCONHIST record for each well, and a
+  single WELOPEN record with the wildcard pattern 'P<step % 10>*'.
+
+    schedulebench [num_wells] [num_steps]
+*/
+
+namespace {
+
+std::string historyDeck(std::size_t num_wells, std::size_t num_steps) {
+    static const char* months[] = {"JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"};
+    std::ostringstream deck;
+
+    deck << "START\n 1 JAN 2000 /\nSCHEDULE\nWELSPECS\n";
+    for (std::size_t well = 0; well < num_wells; well++)
+        deck << " 'P" << well << "' 'G" << well / 100 << "' " << 1 + well % 100 << " " << 1 + (well / 100) % 100 << " 1* 'OIL' /\n";
+    deck << "/\n";
+
+    for (std::size_t step = 0; step < num_steps; step++) {
+        const std::size_t month = step + 1;
+        deck << "DATES\n 1 " << months[month % 12] << " " << 2000 + month / 12 << " /\n/\n";
+
+        deck << "WCONHIST\n";
+        for (std::size_t well = 0; well < num_wells; well++)
+            deck << " 'P" << well << "' 'OPEN' 'ORAT' " << 100 + (well + step) % 50 << " " << 10 + step % 7 << " 1000 /\n";
+        deck << "/\n";
+
+        deck << "WELOPEN\n 'P" << step % 10 << "*' 'OPEN' /\n/\n";
+    }
+    return deck.str();
+}
+
+
+template <typename Function>
+void timeit(const std::string& name, std::size_t num_records, Function function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << name << ": " << seconds << " s (" << 1e6 * seconds / num_records << " us/record)" << std::endl;
+}
+
+}
+
+
+int main(int argc, char** argv) {
+    const std::size_t num_wells = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 3000;
+    const std::size_t num_steps = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 70;
+    if (num_wells == 0 || num_steps == 0) {
+        std::cerr << "usage: schedulebench [num_wells] [num_steps] - both arguments must be positive" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::size_t num_records = num_wells * num_steps;
+    Opm::Parser parser;
+    const auto deck = parser.parseString(historyDeck(num_wells, num_steps));
+
+    const Opm::EclipseGrid grid(100, 100, 10);
+    const Opm::TableManager tables(deck);
+    const Opm::Eclipse3DProperties properties(deck, tables, grid);
+    const Opm::Runspec runspec(deck);
+
+    std::size_t num_wells_created = 0;
+    timeit("Schedule", num_records, [&]() {
+        const Opm::Schedule schedule(deck, grid, properties, runspec);
+        num_wells_created = schedule.numWells();
+    });
+
+    std::cout << "wells: " << num_wells_created << "  report steps: " << num_steps << "  records: " << num_records << std::endl;
+}
@@ -0,0 +1,135 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/VFPEvaluator.hpp>
+
+/*
+  Micro benchmark for the VFP table evaluation: a VFPPROD table with
+  20 FLO, 10 THP, 10 WFR, 10 GFR and 5 ALQ values is evaluated for a
+  number of wells, one well at a time and with the batch methods.
+
+    vfpbench [num_wells] [repeat]
+*/
+
+namespace {
+
+std::vector<double> axis(std::size_t size, double first, double last) {
+    std::vector<double> values(size);
+    for (std::size_t i = 0; i < size; i++)
+        values[i] = first + (last - first) * i / (size - 1);
+    return values;
+}
+
+
+template <typename Function>
+void timeit(const std::string& name, std::size_t num_evaluations, Function function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << name << ": " << 1e9 * seconds / num_evaluations << " ns/well" << std::endl;
+}
+
+}
+
+
+int main(int argc, char** argv) {
+    const std::size_t num_wells = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    const std::size_t repeat = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 100;
+    if (num_wells == 0 || repeat == 0) {
+        std::cerr << "usage: vfpbench [num_wells] [repeat] - both arguments must be positive" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto flo = axis(20, 1e-3, 0.5);
+    const auto thp = axis(10, 1e6, 1e7);
+    const auto wfr = axis(10, 0, 0.95);
+    const auto gfr = axis(10, 10, 500);
+    const auto alq = axis(5, 0, 1);
+
+    Opm::VFPProdTable::extents shape;
+    shape[0] = thp.size();
+    shape[1] = wfr.size();
+    shape[2] = gfr.size();
+    shape[3] = alq.size();
+    shape[4] = flo.size();
+    Opm::VFPProdTable::array_type data(shape);
+    for (std::size_t t = 0; t < thp.size(); t++)
+        for (std::size_t w = 0; w < wfr.size(); w++)
+            for (std::size_t g = 0; g < gfr.size(); g++)
+                for (std::size_t a = 0; a < alq.size(); a++)
+                    for (std::size_t f = 0; f < flo.size(); f++)
+                        data[t][w][g][a][f] = 1.2 * thp[t] + 2e6 * wfr[w] - 1e3 * gfr[g] - 5e5 * alq[a] + 1e7 * flo[f] * flo[f];
+
+    const Opm::VFPProdTable table(1, 2000, Opm::VFPProdTable::FLO_LIQ, Opm::VFPProdTable::WFR_WCT,
+                                  Opm::VFPProdTable::GFR_GOR, Opm::VFPProdTable::ALQ_GRAT,
+                                  flo, thp, wfr, gfr, alq, data);
+    const Opm::VFPProdEvaluator evaluator(table);
+
+    std::vector<double> wat(num_wells), oil(num_wells), gas(num_wells), pressure(num_wells), lift(num_wells);
+    for (std::size_t i = 0; i < num_wells; i++) {
+        const double x = std::sin(0.37 * i);
+        wat[i] = 0.05 + 0.04 * x;
+        oil[i] = 0.1 + 0.08 * std::cos(0.11 * i);
+        gas[i] = oil[i] * (100 + 80 * x);
+        pressure[i] = 5e6 + 4e6 * x;
+        lift[i] = 0.5 + 0.4 * x;
+    }
+
+    std::vector<Opm::VFPEvaluation> result(num_wells);
+    double sum = 0;
+
+    timeit("bhp, single", num_wells * repeat, [&]() {
+        for (std::size_t r = 0; r < repeat; r++)
+            for (std::size_t i = 0; i < num_wells; i++)
+                sum += evaluator.bhp(wat[i], oil[i], gas[i], pressure[i], lift[i]).value;
+    });
+
+    timeit("bhp, batch ", num_wells * repeat, [&]() {
+        for (std::size_t r = 0; r < repeat; r++) {
+            evaluator.bhp(num_wells, wat.data(), oil.data(), gas.data(), pressure.data(), lift.data(), result.data());
+            sum += result[r % num_wells].value;
+        }
+    });
+
+    for (auto& p : pressure)
+        p *= 2;
+
+    timeit("thp, single", num_wells * repeat, [&]() {
+        for (std::size_t r = 0; r < repeat; r++)
+            for (std::size_t i = 0; i < num_wells; i++)
+                sum += evaluator.thp(wat[i], oil[i], gas[i], pressure[i], lift[i]).value;
+    });
+
+    timeit("thp, batch ", num_wells * repeat, [&]() {
+        for (std::size_t r = 0; r < repeat; r++) {
+            evaluator.thp(num_wells, wat.data(), oil.data(), gas.data(), pressure.data(), lift.data(), result.data());
+            sum += result[r % num_wells].value;
+        }
+    });
+
+    std::cout << "checksum: " << sum << std::endl;
+}
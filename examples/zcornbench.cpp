@@ -0,0 +1,129 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+
+/*
+  Micro benchmark for the ZCORN fixup: a synthetic grid with overlapping
+  cells is fixed up with a plain sequential loop and with
+  ZcornMapper::fixupZCORN(), then validated; finally the ZCORN of a
+  rectangular grid of the same size is exported.
+
+    zcornbench [nx ny nz]
+*/
+
+namespace {
+
+template <typename Function>
+void timeit(const std::string& name, std::size_t num_cells, Function function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << name << ": " << seconds << " s (" << 1e9 * seconds / num_cells << " ns/cell)" << std::endl;
+}
+
+
+/* The loop from before the fixup was parallelised, used as reference. */
+std::size_t sequentialFixup(const Opm::ZcornMapper& mapper, std::size_t nx, std::size_t ny, std::size_t nz, std::vector<double>& zcorn) {
+    const int sign = zcorn[ mapper.index(0,0,0,0) ] <= zcorn[ mapper.index(0,0,nz - 1,4) ] ? 1 : -1;
+    std::size_t adjusted = 0;
+
+    for (std::size_t k=0; k < nz; k++)
+        for (std::size_t j=0; j < ny; j++)
+            for (std::size_t i=0; i < nx; i++)
+                for (int c=0; c < 4; c++) {
+                    if (k > 0) {
+                        const auto above = mapper.index(i,j,k-1,c+4);
+                        const auto top = mapper.index(i,j,k,c);
+                        if ((zcorn[top] - zcorn[above]) * sign < 0) {
+                            zcorn[top] = zcorn[above];
+                            adjusted++;
+                        }
+                    }
+
+                    const auto top = mapper.index(i,j,k,c);
+                    const auto bottom = mapper.index(i,j,k,c+4);
+                    if ((zcorn[bottom] - zcorn[top]) * sign < 0) {
+                        zcorn[bottom] = zcorn[top];
+                        adjusted++;
+                    }
+                }
+
+    return adjusted;
+}
+
+}
+
+
+int main(int argc, char** argv) {
+    if (argc != 1 && argc != 4) {
+        std::cerr << "usage: zcornbench [nx ny nz]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::size_t nx = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 500;
+    const std::size_t ny = (argc > 1) ? std::strtoul(argv[2], nullptr, 10) : 500;
+    const std::size_t nz = (argc > 1) ? std::strtoul(argv[3], nullptr, 10) : 400;
+    if (nx == 0 || ny == 0 || nz == 0) {
+        std::cerr << "usage: zcornbench [nx ny nz] - all dimensions must be positive" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::size_t num_cells = nx * ny * nz;
+    Opm::ZcornMapper mapper(nx, ny, nz);
+    std::vector<double> zcorn(mapper.size());
+    for (std::size_t k=0; k < nz; k++)
+        for (std::size_t j=0; j < ny; j++)
+            for (std::size_t i=0; i < nx; i++)
+                for (int c=0; c < 8; c++) {
+                    const auto index = mapper.index(i,j,k,c);
+                    zcorn[index] = 1000 + 2.0 * (k + c / 4) + ((index * 7919) % 13) * 0.2 - 1.2;
+                }
+
+    auto reference = zcorn;
+    std::size_t reference_adjusted = 0;
+    std::size_t adjusted = 0;
+    bool valid = false;
+
+    timeit("sequential fixup", num_cells, [&]() { reference_adjusted = sequentialFixup(mapper, nx, ny, nz, reference); });
+    timeit("fixupZCORN      ", num_cells, [&]() { adjusted = mapper.fixupZCORN(zcorn); });
+    timeit("validZCORN      ", num_cells, [&]() { valid = mapper.validZCORN(zcorn); });
+
+    if (adjusted != reference_adjusted || zcorn != reference || !valid) {
+        std::cerr << "fixupZCORN differs from the sequential reference" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    {
+        std::vector<double>().swap(reference);
+        std::vector<double>().swap(zcorn);
+        const Opm::EclipseGrid grid(nx, ny, nz, 1, 1, 1);
+        std::vector<double> exported;
+        timeit("exportZCORN     ", num_cells, [&]() { grid.exportZCORN(exported); });
+    }
+
+    std::cout << "points adjusted: " << adjusted << std::endl;
+}
@@ -0,0 +1,115 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_ACTIVE_INDEX_MAP_HPP
+#define OPM_ACTIVE_INDEX_MAP_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Opm {
+
+/*
+  The ActiveIndexMap class holds the mapping between global cell indices and
+  active cell indices as two dense arrays:
+
+    globalToActive(): size global_size, the active index of each cell or -1
+       for inactive cells.
+
+    activeToGlobal(): size active_size, the global index of each active cell.
+
+  All lookups are O(1). The compress() and expand() methods will gather a
+  global array to the active cells, and scatter an active array out to all
+  the cells respectively; large arrays are processed in parallel, except
+  std::vector<bool> where neighbouring elements share a word.
+*/
+
+class ActiveIndexMap {
+public:
+    ActiveIndexMap() = default;
+    explicit ActiveIndexMap(std::size_t global_size);
+    explicit ActiveIndexMap(const std::vector<int>& actnum);
+    ActiveIndexMap(std::size_t global_size, const int* actnum);
+
+    std::size_t globalSize() const;
+    std::size_t activeSize() const;
+    bool allActive() const;
+
+    bool isActive(std::size_t global_index) const;
+    int activeIndex(std::size_t global_index) const;
+    int globalIndex(std::size_t active_index) const;
+
+    const std::vector<int>& globalToActive() const;
+    const std::vector<int>& activeToGlobal() const;
+
+    bool operator==(const ActiveIndexMap& other) const;
+    bool operator!=(const ActiveIndexMap& other) const;
+
+    template <typename T>
+    std::vector<T> compress(const std::vector<T>& global_data) const {
+        if (global_data.size() != this->globalSize())
+            throw std::invalid_argument("Can not compress array of size " + std::to_string(global_data.size()) +
+                                        " expected: " + std::to_string(this->globalSize()));
+
+        std::vector<T> active_data(this->activeSize());
+        const long size = static_cast<long>(active_data.size());
+        const int* active_to_global = this->active_to_global.data();
+
+#pragma omp parallel for if (parallel<T>(size))
+        for (long active_index = 0; active_index < size; active_index++)
+            active_data[active_index] = global_data[active_to_global[active_index]];
+
+        return active_data;
+    }
+
+    template <typename T>
+    std::vector<T> expand(const std::vector<T>& active_data, const T& default_value = T{}) const {
+        if (active_data.size() != this->activeSize())
+            throw std::invalid_argument("Can not expand array of size " + std::to_string(active_data.size()) +
+                                        " expected: " + std::to_string(this->activeSize()));
+
+        std::vector<T> global_data(this->globalSize(), default_value);
+        const long size = static_cast<long>(active_data.size());
+        const int* active_to_global = this->active_to_global.data();
+
+#pragma omp parallel for if (parallel<T>(size))
+        for (long active_index = 0; active_index < size; active_index++)
+            global_data[active_to_global[active_index]] = active_data[active_index];
+
+        return global_data;
+    }
+
+private:
+    static const long min_parallel_size = 100000;
+
+    template <typename T>
+    static bool parallel(long size) {
+        return !std::is_same<T, bool>::value && size > min_parallel_size;
+    }
+
+    std::vector<int> global_to_active;
+    std::vector<int> active_to_global;
+};
+
+}
+
+#endif
@@ -3,6 +3,7 @@
 #ifndef _MONOTCUBICINTERPOLATOR_H
 #define _MONOTCUBICINTERPOLATOR_H
 
+#include <cstddef>
 #include <vector>
 #include <map>
 #include <string>
@@ -206,6 +207,17 @@ class MonotCubicInterpolator {
    */
    double evaluate(double x) const;
 
+   /**
+      @param x array of n x values
+      @param out array of n values, out[i] = f(x[i])
+
+      Evaluates the function for many x values in one call, giving
+      the same results as calling evaluate(double) for each value.
+      The interval found for one value is tried first for the next,
+      so sorted input avoids the binary search.
+   */
+   void evaluate(const double* x, double* out, size_t n) const;
+
    /**
       @param x x value
       @param errorestimate_output
@@ -501,8 +513,14 @@ private:
    mutable std::map<double, double> ddata;
 
 
-   // Storage containers for precomputed interpolation data
-   //   std::vector<double> dvalues; // derivatives in Hermite interpolation.
+   // Storage containers for precomputed interpolation data, flat
+   // copies of data and ddata which are used by evaluate(). The
+   // dvalues are empty if we should interpolate linearly, and
+   // slopes are then the slopes of the intervals.
+   mutable std::vector<double> xvalues;
+   mutable std::vector<double> fvalues;
+   mutable std::vector<double> dvalues; // derivatives in Hermite interpolation.
+   mutable std::vector<double> slopes;
 
    // Flag to determine whether the boolean strictlyMonotone can be
    // trusted.
@@ -540,6 +558,19 @@ private:
 
    void computeInternalFunctionData() const ;
 
+   /**
+      Copies data and ddata to the flat arrays used by evaluate(), must
+      be called whenever data or ddata has been changed.
+   */
+   void updateFlatData() const ;
+
+   /**
+      Returns i such that xvalues[i] < x <= xvalues[i+1], clamped to
+      the first and last interval if x is out of range. The interval
+      hint is tried before searching.
+   */
+   size_t findInterval(double x, size_t hint) const ;
+
    /**
        Computes initial derivative values using centered (second order) difference
        for internal datapoints, and one-sided derivative for endpoints
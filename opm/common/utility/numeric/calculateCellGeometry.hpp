@@ -0,0 +1,77 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CALCULATE_CELL_GEOMETRY_HPP
+#define OPM_CALCULATE_CELL_GEOMETRY_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace Opm {
+
+/*
+  The geometry of all the cells in a corner point grid, stored as one array
+  for each quantity and indexed with the global cell index. The center is
+  the average of the eight corners, the depth is the z coordinate of the
+  center and the thickness is the average distance in the z direction
+  between the top and bottom corners of the four pillars.
+*/
+
+struct CellGeometry {
+    std::vector<double> volume;
+    std::vector<double> center_x;
+    std::vector<double> center_y;
+    std::vector<double> depth;
+    std::vector<double> thickness;
+};
+
+
+/*
+  Will calculate the geometry of all the cells in a nx*ny*nz corner point
+  grid directly from the COORD and ZCORN arrays, i.e. without assembling
+  the corners of one cell at a time. The corners of one row of cells are
+  gathered into separate arrays for x, y and z, and the cell volumes are
+  evaluated with a closed form version of the formula used in
+  calculateCellVol() in a loop which can be vectorized. The layers are
+  processed in parallel.
+*/
+
+CellGeometry calculateCellGeometry(std::size_t nx, std::size_t ny, std::size_t nz,
+                                   const std::vector<double>& coord,
+                                   const std::vector<double>& zcorn);
+
+/*
+  As calculateCellGeometry(), but only the cell volumes are calculated.
+*/
+
+std::vector<double> calculateCellVolumes(std::size_t nx, std::size_t ny, std::size_t nz,
+                                         const std::vector<double>& coord,
+                                         const std::vector<double>& zcorn);
+
+/*
+  The depth of all the cells, i.e. the average z coordinate of the eight
+  corners; only the ZCORN array is needed.
+*/
+
+std::vector<double> calculateCellDepths(std::size_t nx, std::size_t ny, std::size_t nz,
+                                        const std::vector<double>& zcorn);
+
+}
+
+#endif
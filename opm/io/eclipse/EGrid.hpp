@@ -19,6 +19,7 @@
 #ifndef OPM_IO_EGRID_HPP
 #define OPM_IO_EGRID_HPP
 
+#include <opm/common/utility/ActiveIndexMap.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 
 #include <array>
@@ -47,15 +48,13 @@ public:
     void getCellCorners(int globindex, std::vector<double>& X, std::vector<double>& Y, std::vector<double>& Z) const;
     void getCellCorners(const std::array<int, 3>& ijk, std::vector<double>& X, std::vector<double>& Y, std::vector<double>& Z) const;
 
-    int activeCells() const { return nactive; }
+    int activeCells() const { return static_cast<int>(active_map.activeSize()); }
     int totalNumberOfCells() const { return nijk[0] * nijk[1] * nijk[2]; }
+    const ActiveIndexMap& activeIndexMap() const { return active_map; }
 
 private:
     std::array<int, 3> nijk;
-    int nactive;
-
-    std::vector<int> act_index;
-    std::vector<int> glob_index;
+    ActiveIndexMap active_map;
     std::vector<float> coord_array;
     std::vector<float> zcorn_array;
 };
@@ -40,10 +40,24 @@ public:
     bool hasReportStepNumber(int number) const;
 
     void loadReportStepNumber(int number);
+    void loadReportStepNumber(int number, const std::vector<std::string>& arrays);
+    void unloadReportStepNumber(int number);
 
     template <typename T>
     const std::vector<T>& getRst(const std::string& name, int reportStepNumber);
 
+    // Elements [first, first + count) and a list of elements respectively,
+    // read from file without loading the full array.
+    template <typename T>
+    std::vector<T> getRst(const std::string& name, int reportStepNumber, int first, int count);
+
+    template <typename T>
+    std::vector<T> getRst(const std::string& name, int reportStepNumber, const std::vector<int>& elements);
+
+    // The elements of array name for all report steps, ordered as listOfReportStepNumbers()
+    template <typename T>
+    std::vector<std::vector<T>> getRstTimeSeries(const std::string& name, const std::vector<int>& elements);
+
     const std::vector<int>& listOfReportStepNumbers() const { return seqnum; }
 
     std::vector<EclEntry> listOfRstArrays(int reportStepNumber);
@@ -60,6 +74,7 @@ private:
     void initSeparate(const int number);
 
     int getArrayIndex(const std::string& name, int seqnum) const;
+    int findArrayIndex(const std::string& name, int seqnum) const;
 
     std::streampos
     restartStepWritePosition(const int seqnumValue) const;
@@ -43,6 +43,10 @@ public:
     void loadData(int arrIndex);                // load data based on array indices in vector arrIndex
     void loadData(const std::vector<int>& arrIndex);   // load data based on array indices in vector arrIndex
 
+    void unloadData(const std::string& arrName);       // release all arrays with array name equal to arrName
+    void unloadData(int arrIndex);                     // release data for array with index arrIndex
+    void unloadData(const std::vector<int>& arrIndex); // release data for arrays with indices in vector arrIndex
+
     void clearData()
     {
       inte_array.clear();
@@ -50,6 +54,7 @@ public:
       doub_array.clear();
       logi_array.clear();
       char_array.clear();
+      arrayLoaded.assign(arrayLoaded.size(), false);
     }
 
     using EclEntry = std::tuple<std::string, eclArrType, int>;
@@ -61,6 +66,10 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    // read the elements with the given indices directly from file, without loading the full array
+    template <typename T>
+    std::vector<T> getElements(int arrIndex, const std::vector<int>& elements);
+
     bool hasKey(const std::string &name) const;
 
     const std::vector<std::string>& arrayNames() const { return array_name; }
@@ -107,6 +116,12 @@ private:
     std::vector<bool> arrayLoaded;
 
     void loadArray(std::fstream& fileH, int arrIndex);
+
+    template<class T, class Decode>
+    std::vector<T> getElementsImpl(int arrIndex, eclArrType type,
+                                   const std::unordered_map<int, std::vector<T>>& array,
+                                   const std::string& typeStr,
+                                   const std::vector<int>& elements, Decode decode);
 };
 
 }} // namespace Opm::EclIO
@@ -61,6 +61,9 @@ public:
             writeFormattedHeader(name, data.size(), arrType);
             if (arrType != MESS)
                 writeFormattedArray(data);
+
+            // Formatted arrays are flushed when complete, not per line.
+            ofileH.flush();
         }
         else
         {
@@ -91,9 +94,6 @@ private:
     void writeFormattedCharArray(const std::vector<std::string>& data);
     void writeFormattedCharArray(const std::vector<PaddedOutputString<8>>& data);
 
-    std::string make_real_string(float value) const;
-    std::string make_doub_string(double value) const;
-
     bool isFormatted;
     std::ofstream ofileH;
 };
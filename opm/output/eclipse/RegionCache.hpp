@@ -20,8 +20,13 @@
 #ifndef OPM_REGION_CACHE_HPP
 #define OPM_REGION_CACHE_HPP
 
+#include <cstddef>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include <opm/output/data/Wells.hpp>
+
 namespace Opm {
     class Eclipse3DProperties;
     class Schedule;
@@ -30,14 +35,70 @@ namespace Opm {
 namespace out {
     class RegionCache {
     public:
+        /*
+          A connection of the region layout: the well is an index into
+          wells(), the connection is the index in the WellConnections of
+          the well and active_index is the active cell of the connection.
+        */
+        struct Connection {
+            std::size_t well;
+            std::size_t connection;
+            std::size_t active_index;
+        };
+
         RegionCache() = default;
         RegionCache(const Eclipse3DProperties& properties, const EclipseGrid& grid, const Schedule& schedule);
-        const std::vector<std::pair<std::string,size_t>>& connections( int region_id ) const;
+
+        /*
+          Builds the region layout for the wells of report_step. The layout
+          is only rebuilt if wells or connections have changed since the
+          previous update; the return value tells if it was rebuilt.
+        */
+        bool update(const Schedule& schedule, std::size_t report_step);
+
+        /*
+          The wells of the layout; a well handle is an index in this vector
+          and is valid until the next rebuild.
+        */
+        const std::vector<std::string>& wells() const;
+
+        /*
+          The connections of region_id in the layout, as the half open
+          range [first, last) of connection indices; the connections of
+          all regions are stored contiguously in region order.
+        */
+        std::pair<std::size_t, std::size_t> region_range( int region_id ) const;
+        const Connection& connection( std::size_t index ) const;
+
+        /*
+          Sums the connection rates of every region, in parallel over the
+          regions. The rate of each connection is multiplied with the
+          efficiency factor of its well, indexed by well handle, and is
+          counted as injection if positive and production if negative.
+        */
+        void update_rates(const data::Wells& wells, const std::vector<double>& efficiency_factors);
+
+        /*
+          The water, oil or gas rate of region_id from the last call to
+          update_rates(); the production rate is negative.
+        */
+        double rate( int region_id, data::Rates::opt phase, bool injection ) const;
 
     private:
-        std::vector<std::pair<std::string,size_t>> connections_empty;
+        /* The region and active index of each global cell, -1 if inactive. */
+        std::vector<int> cell_region;
+        std::vector<int> cell_active_index;
+        std::size_t nx = 0;
+        std::size_t ny = 0;
+
+        bool has_layout = false;
+        std::size_t layout_step = 0;
+        std::vector<std::string> well_names;
+        std::vector<std::size_t> region_offset;
+        std::vector<Connection> region_connections;
 
-        std::map<int , std::vector<std::pair<std::string,size_t>>> connection_map;
+        /* Six rates per region: production and injection of water, oil and gas. */
+        std::vector<double> region_rates;
     };
 }
 }
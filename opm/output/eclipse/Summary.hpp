@@ -20,11 +20,13 @@
 #ifndef OPM_OUTPUT_SUMMARY_HPP
 #define OPM_OUTPUT_SUMMARY_HPP
 
+#include <cstddef>
 #include <map>
 #include <string>
 #include <vector>
 
 #include <ert/ecl/ecl_sum.h>
+#include <ert/util/ert_unique_ptr.hpp>
 
 #include <opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp>
@@ -44,6 +46,16 @@ namespace out {
 
 class Summary {
 public:
+    /*
+      A block summary vector of the summary configuration, e.g. BPR for
+      one cell, with the global and active index of the cell.
+    */
+    struct BlockRequest {
+        std::string keyword;
+        std::size_t global_index;
+        std::size_t active_index;
+    };
+
     Summary( const EclipseState&, const SummaryConfig&, const EclipseGrid&, const Schedule& );
     Summary( const EclipseState&, const SummaryConfig&, const EclipseGrid&, const Schedule&, const std::string& );
     Summary( const EclipseState&, const SummaryConfig&, const EclipseGrid&, const Schedule&, const char* basename );
@@ -58,6 +70,11 @@ public:
                       const std::map<std::pair<std::string, int>, double>& block_values = {});
 
 
+    /*
+      The evaluation updates the region connection layout and the region
+      rates kept by the Summary object, so eval() and eval_blocks() are
+      not const.
+    */
     void eval(SummaryState& summary_state,
               int report_step,
               double secs_elapsed,
@@ -66,7 +83,35 @@ public:
               const data::Wells&,
               const std::map<std::string, double>& single_values,
               const std::map<std::string, std::vector<double>>& region_values = {},
-              const std::map<std::pair<std::string, int>, double>& block_values = {}) const;
+              const std::map<std::pair<std::string, int>, double>& block_values = {});
+
+    /*
+      The block vectors to be evaluated by the simulator. The requests are
+      fixed when the Summary object is created; the block values can then
+      be passed to add_timestep_blocks() and eval_blocks() as one array
+      in SI units, with the value of block_requests()[i] in
+      block_values[i].
+    */
+    const std::vector<BlockRequest>& block_requests() const;
+
+    void add_timestep_blocks(int report_step,
+                             double secs_elapsed,
+                             const EclipseState& es,
+                             const Schedule& schedule,
+                             const data::Wells&,
+                             const std::map<std::string, double>& single_values,
+                             const std::map<std::string, std::vector<double>>& region_values,
+                             const std::vector<double>& block_values);
+
+    void eval_blocks(SummaryState& summary_state,
+                     int report_step,
+                     double secs_elapsed,
+                     const EclipseState& es,
+                     const Schedule& schedule,
+                     const data::Wells&,
+                     const std::map<std::string, double>& single_values,
+                     const std::map<std::string, std::vector<double>>& region_values,
+                     const std::vector<double>& block_values);
 
 
 
@@ -80,6 +125,16 @@ public:
 private:
     void internal_store(const SummaryState& summary_state, int report_step, double seconds_elapsed);
 
+    /* Evaluates everything but the block vectors and the UDQs. */
+    void internal_eval(SummaryState& summary_state,
+                       int report_step,
+                       double secs_elapsed,
+                       const EclipseState& es,
+                       const Schedule& schedule,
+                       const data::Wells&,
+                       const std::map<std::string, double>& single_values,
+                       const std::map<std::string, std::vector<double>>& region_values);
+
 
     class keyword_handlers;
 
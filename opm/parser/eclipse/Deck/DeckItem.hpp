@@ -20,9 +20,11 @@
 #ifndef DECKITEM_HPP
 #define DECKITEM_HPP
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <ostream>
 
 #include <opm/parser/eclipse/Units/Dimension.hpp>
@@ -125,6 +127,26 @@ namespace Opm {
         std::vector< Dimension > dimensions;
         mutable std::vector< double > SIdata;
 
+        /*
+          The SI data is filled lazily by the const getSIDoubleData(); the
+          fill is guarded with a mutex and double checked, so several
+          threads can read the same const deck. A copied item copies the
+          SI data together with the flag.
+        */
+        struct SIConversion {
+            SIConversion() = default;
+            SIConversion(const SIConversion& other) noexcept : done( other.done.load() ) {}
+            SIConversion& operator=(const SIConversion& other) noexcept {
+                this->done = other.done.load();
+                return *this;
+            }
+
+            std::atomic<bool> done{false};
+            std::mutex mutex;
+        };
+        mutable SIConversion SIconversion;
+
+        void convertSIData( const std::vector< double >& raw ) const;
         template< typename T > std::vector< T >& value_ref();
         template< typename T > const std::vector< T >& value_ref() const;
         template< typename T > void push( T );
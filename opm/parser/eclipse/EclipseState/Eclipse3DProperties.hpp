@@ -19,6 +19,7 @@
 #ifndef OPM_ECLIPSE_PROPERTIES_HPP
 #define OPM_ECLIPSE_PROPERTIES_HPP
 
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -39,6 +40,7 @@ namespace Opm {
     class DeckKeyword;
     class DeckRecord;
     class EclipseGrid;
+    class SatfuncEndpointCache;
     class Section;
     class TableManager;
     class UnitSystem;
@@ -71,8 +73,39 @@ namespace Opm {
         bool hasDeckDoubleGridProperty(const std::string& keyword) const;
         bool supportsGridProperty(const std::string& keyword) const;
 
+        /*
+          Announce the endpoint scaling properties, e.g. SWL, SWCR and KRW,
+          which will be requested, so that their arrays are computed in one
+          pass over the grid when the first of them is needed. The endpoint
+          properties which are mentioned in the deck are announced by the
+          constructor; properties which are not announced are computed one
+          at a time.
+        */
+        void requestSatfuncEndpoints(const std::vector<std::string>& keywords) const;
+
+        /*
+          Limit the memory used by the properties which can be recreated
+          from their initializer, the budget applies separately to the
+          integer and the double properties. See
+          GridProperties<T>::setMemoryBudget() for details; the budget is
+          only enforced by explicit calls to enforceMemoryBudget().
+        */
+        void setMemoryBudget(std::size_t bytes);
+        std::size_t enforceMemoryBudget();
+        std::size_t memoryUsage() const;
+
+        /*
+          Store the properties which are constant over large ranges, like
+          the region properties, in a compact run length encoded form. The
+          properties are expanded again when getData() is called. The
+          integer properties are compressed when the deck has been
+          processed.
+        */
+        std::size_t compress();
+
     private:
         const GridProperty<int>& getRegion(const DeckItem& regionItem) const;
+        void requestDeckSatfuncEndpoints(const Deck& deck) const;
         void processGridProperties(const Deck& deck,
                                    const EclipseGrid& eclipseGrid);
 
@@ -101,6 +134,7 @@ namespace Opm {
         std::string            m_defaultRegion;
         UnitSystem             m_deckUnitSystem;
         GridProperties<int>    m_intGridProperties;
+        std::shared_ptr<SatfuncEndpointCache> m_satfuncEndpoints;
         GridProperties<double> m_doubleGridProperties;
     };
 }
@@ -68,7 +68,15 @@ namespace Opm {
 
         template<typename T>
         EclipseState(const Deck& deck , const ParseContext& parseContext, T&& errors);
-        EclipseState(const Deck& deck , const ParseContext& parseContext, ErrorGuard& errors);
+
+        /*
+          With parallel_init == true the components which only depend on
+          the deck - i.e. the tables, the runspec, the NNC and EDITNNC
+          input and the input grid - are constructed as concurrent tasks.
+          The construction time of the components is reported with
+          OpmLog::debug().
+        */
+        EclipseState(const Deck& deck , const ParseContext& parseContext, ErrorGuard& errors, bool parallel_init = false);
         EclipseState(const Deck& deck);
 
         const IOConfig& getIOConfig() const;
@@ -95,6 +103,18 @@ namespace Opm {
         bool hasInputEDITNNC() const;
 
         const Eclipse3DProperties& get3DProperties() const;
+
+        /*
+          Limit the memory used by the grid properties which can be
+          recreated from their initializer, see
+          Eclipse3DProperties::setMemoryBudget(). The budget is only
+          enforced when the owner of the EclipseState calls
+          enforceMemoryBudget(), typically when it is done with the
+          properties; that invalidates references obtained from
+          GridProperty::getData().
+        */
+        void setMemoryBudget(std::size_t bytes);
+        std::size_t enforceMemoryBudget();
         const TableManager& getTableManager() const;
         const EclipseConfig& getEclipseConfig() const;
         const EclipseConfig& cfg() const;
@@ -112,6 +132,9 @@ namespace Opm {
         const Runspec& runspec() const;
 
     private:
+        struct InitTasks;
+        EclipseState(const Deck& deck , const ParseContext& parseContext, ErrorGuard& errors, InitTasks&& tasks);
+
         void initIOConfigPostSchedule(const Deck& deck);
         void initTransMult();
         void initFaults(const Deck& deck);
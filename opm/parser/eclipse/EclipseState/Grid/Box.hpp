@@ -23,6 +23,8 @@
 
 #include <vector>
 #include <cstddef>
+#include <memory>
+#include <mutex>
 
 namespace Opm {
 
@@ -38,6 +40,17 @@ namespace Opm {
         const std::vector<size_t>& getIndexList() const;
         bool equal(const Box& other) const;
 
+        /*
+          The cells in the box are organized in runs of contiguous global
+          indices, one run for each (j,k) combination, with runLength()
+          cells in each run. Iterating over the runs does not require the
+          index list - which is only assembled on demand when
+          getIndexList() or the iterators are used.
+        */
+        size_t numRuns() const;
+        size_t runLength() const;
+        size_t runStart(size_t run) const;
+
         explicit operator bool() const;
         std::vector<size_t>::const_iterator begin() const;
         std::vector<size_t>::const_iterator end() const;
@@ -51,13 +64,32 @@ namespace Opm {
         int K2() const;
 
     private:
-        void initIndexList();
+        /*
+          The index list is assembled at most once, on first use; the
+          std::once_flag makes this safe when several threads use the
+          same const Box. A copied or assigned Box starts out without an
+          index list and assembles its own when needed.
+        */
+        struct IndexList {
+            IndexList() : once( new std::once_flag ) {}
+            IndexList(const IndexList&) : IndexList() {}
+            IndexList& operator=(const IndexList&) {
+                this->indices.clear();
+                this->once.reset( new std::once_flag );
+                return *this;
+            }
+
+            std::vector<size_t> indices;
+            std::unique_ptr<std::once_flag> once;
+        };
+
+        void initIndexList() const;
         size_t m_dims[3] = { 0, 0, 0 };
         size_t m_offset[3];
         size_t m_stride[3];
 
         bool   m_isGlobal;
-        std::vector<size_t> m_indexList;
+        mutable IndexList m_indexList;
 
         int lower(int dim) const;
         int upper(int dim) const;
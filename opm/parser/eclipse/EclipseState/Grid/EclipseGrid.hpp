@@ -22,13 +22,14 @@
 #define OPM_PARSER_ECLIPSE_GRID_HPP
 
 
+#include <opm/common/utility/ActiveIndexMap.hpp>
+#include <opm/common/utility/numeric/calculateCellGeometry.hpp>
 #include <opm/parser/eclipse/EclipseState/Util/Value.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/MinpvMode.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/PinchMode.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/GridDims.hpp>
 
 #include <ert/ecl/ecl_grid.h>
-#include <ert/util/ert_unique_ptr.hpp>
 
 #include <array>
 #include <memory>
@@ -136,21 +137,14 @@ namespace Opm {
             if (input_vector.size() != getCartesianSize())
                 throw std::invalid_argument("Input vector must have full size");
 
-            {
-                std::vector<T> compressed_vector( this->getNumActive() );
-                const auto& active_map = this->getActiveMap( );
-
-                for (size_t i = 0; i < this->getNumActive(); ++i)
-                    compressed_vector[i] = input_vector[ active_map[i] ];
-
-                return compressed_vector;
-            }
+            return m_activeMap->compress( input_vector );
         }
 
 
         /// Will return a vector a length num_active; where the value
         /// of each element is the corresponding global index.
         const std::vector<int>& getActiveMap() const;
+        const ActiveIndexMap& activeIndexMap() const;
         std::array<double, 3> getCellCenter(size_t i,size_t j, size_t k) const;
         std::array<double, 3> getCellCenter(size_t globalIndex) const;
         std::array<double, 3> getCornerPos(size_t i,size_t j, size_t k, size_t corner_index) const;
@@ -166,6 +160,21 @@ namespace Opm {
         double getCellDepth(size_t globalIndex) const;
         ZcornMapper zcornMapper() const;
 
+        /*
+          Will calculate the volume, center, depth and thickness of all cells
+          in one pass and fill the volume cache. For grids which are defined
+          by pillars the calculation goes directly on the COORD and ZCORN
+          arrays, which is much faster than calling the per cell methods.
+        */
+        CellGeometry getCellGeometry() const;
+
+        /*
+          As getCellGeometry(), but only the cell volumes or the cell depths
+          are calculated.
+        */
+        std::vector<double> getCellVolumes() const;
+        std::vector<double> getCellDepths() const;
+
         /*
           The exportZCORN method will adjust the z coordinates to ensure that cells do not
           overlap. The return value is the number of points which have been adjusted.
@@ -187,24 +196,33 @@ namespace Opm {
         PinchMode::ModeEnum m_pinchoutMode;
         PinchMode::ModeEnum m_multzMode;
         mutable std::vector<double> volume_cache;
-        mutable std::vector< int > activeMap;
+        std::shared_ptr<const ActiveIndexMap> m_activeMap;
         bool m_circle = false;
+        bool m_pillar_grid = false;
         /*
-          The internal class grid_ptr is a a std::unique_ptr with
-          special copy semantics. The purpose of implementing this is
-          that the EclipseGrid class can now use the default
-          implementation for the copy and move constructors.
+          The libecl grid is immutable after construction, apart from
+          resetACTNUM() and addNNC(), and it is therefore shared between
+          copies of the EclipseGrid. The mutating methods go through
+          mutable_grid() which will create a private copy of the libecl
+          grid if it is shared. The mapping between active and global
+          indices is kept in m_activeMap, so the index queries do not call
+          into libecl. libecl keeps its own index maps inside the grid, so
+          m_activeMap is an extra 4 bytes per cell and 4 bytes per active
+          cell; it is immutable and shared between copies as well.
         */
-        using ert_ptr = ERT::ert_unique_ptr<ecl_grid_type , ecl_grid_free>;
-        class grid_ptr : public ert_ptr {
+        class grid_ptr : public std::shared_ptr<ecl_grid_type> {
         public:
-            using ert_ptr::unique_ptr;
             grid_ptr() = default;
-            grid_ptr(grid_ptr&&) = default;
-            grid_ptr(const grid_ptr& src) :
-                ert_ptr( ecl_grid_alloc_copy( src.get() ) ) {}
+            explicit grid_ptr(ecl_grid_type* grid) :
+                std::shared_ptr<ecl_grid_type>( grid , ecl_grid_free ) {}
+
+            void reset(ecl_grid_type* grid) {
+                std::shared_ptr<ecl_grid_type>::reset( grid , ecl_grid_free );
+            }
         };
         grid_ptr m_grid;
+        ecl_grid_type * mutable_grid();
+        void initActiveMaps();
         void initBinaryGrid(const Deck& deck);
 
         void initCornerPointGrid(const std::array<int,3>& dims ,
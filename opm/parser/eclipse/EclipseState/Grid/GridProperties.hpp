@@ -129,6 +129,28 @@ namespace Opm {
 
         GridProperty<T>& getOrCreateProperty(const std::string& name);
 
+        /*
+          With a non-zero memory budget the properties which have not been
+          modified, i.e. which can be recreated from their initializer, are
+          released by enforceMemoryBudget() - least recently used first -
+          until their total size is within the budget; released properties
+          are recreated when they are accessed again. Modified properties
+          are not counted against the budget and are never released.
+          Properties are only released by enforceMemoryBudget(), which
+          invalidates references obtained from getData(); the const
+          accessors never release anything. enforceMemoryBudget() returns
+          the number of bytes released.
+        */
+        void setMemoryBudget(std::size_t bytes);
+        std::size_t enforceMemoryBudget();
+        std::size_t memoryUsage() const;
+
+        /*
+          Will call GridProperty<T>::compress() for all the properties, and
+          return the number of bytes saved.
+        */
+        std::size_t compress();
+
         /**
            The fine print of the manual says the ADD keyword should support
            some state dependent semantics regarding endpoint scaling arrays
@@ -204,6 +226,7 @@ namespace Opm {
         mutable std::unordered_map<std::string, SupportedKeywordInfo> m_supportedKeywords;
         mutable storage m_properties;
         mutable std::set<std::string> m_autoGeneratedProperties;
+        std::size_t m_memoryBudget = 0;
     };
 
 }
@@ -19,7 +19,10 @@
 #ifndef ECLIPSE_GRIDPROPERTY_HPP_
 #define ECLIPSE_GRIDPROPERTY_HPP_
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -157,6 +160,39 @@ public:
       assembling the properties.
     */
     void runPostProcessor();
+
+    /*
+      A property which has only been created from the initializer and post
+      processor of the keyword, i.e. which has not been modified, can be
+      released and is then recreated from the initializer when it is
+      accessed again. If the released property is constant only the value
+      is retained, and iget() does not need to recreate the data. The
+      release() method returns the number of bytes released; references
+      returned from getData() are invalidated.
+
+      The touch() method records an access to the property, the
+      GridProperties container uses lastAccess() to release the least
+      recently used properties first.
+    */
+    bool isRegenerable() const;
+    std::size_t memoryUsage() const;
+    std::size_t release();
+    void touch() const;
+    std::size_t lastAccess() const;
+
+    /*
+      The compress() method will store the property as a list of runs of
+      constant value, if that is more compact than the dense vector. This
+      is typically the case for region properties like SATNUM and
+      PVTNUM. The iget(), initMask(), indexEqual() and cellsEqual()
+      methods, the box operations and the post processor work directly on
+      the compact representation; getData() and the other updates will
+      expand the property to a dense vector again. Returns the number of
+      bytes saved.
+    */
+    std::size_t compress();
+    bool isCompact() const;
+
      /*
       Will scan through the roperty and return a vector of all the
       indices where the property value agrees with the input value.
@@ -265,12 +301,55 @@ public:
 private:
     const DeckItem& getDeckItem( const DeckKeyword& );
     void setDataPoint(size_t sourceIdx, size_t targetIdx, const DeckItem& deckItem);
+    void materialize() const;
+    void pin();
+    void setRuns() const;
+    size_t runIndex(size_t index) const;
+    template <typename F>
+    bool updateCompact(const Box& inputBox, F op);
 
     size_t m_nx, m_ny, m_nz;
     SupportedKeywordInfo m_kwInfo;
-    std::vector<T> m_data;
+    mutable std::vector<T> m_data;
     bool m_hasRunPostProcessor = false;
     bool assigned = false;
+    bool m_regenerable = true;
+    /*
+      The const accessors materialize the property on demand, and can be
+      called from several threads at once: the flag is atomic and the
+      materialization runs under the mutex. The non-const methods, among
+      them compress() and release(), must not run concurrently with any
+      other access to the property.
+    */
+    struct Materialization {
+        Materialization() = default;
+        Materialization(const Materialization& other) : done( other.done.load() ) {}
+        Materialization& operator=(const Materialization& other) {
+            this->done = other.done.load();
+            return *this;
+        }
+
+        std::atomic<bool> done{true};
+        std::mutex mutex;
+    };
+
+    mutable Materialization m_materialized;
+
+    struct AccessStamp {
+        AccessStamp() = default;
+        AccessStamp(const AccessStamp& other) : value( other.value.load() ) {}
+        AccessStamp& operator=(const AccessStamp& other) {
+            this->value = other.value.load();
+            return *this;
+        }
+
+        std::atomic<std::size_t> value{0};
+    };
+
+    mutable AccessStamp m_lastAccess;
+    mutable bool m_compact = false;
+    mutable std::vector<size_t> m_runStart;
+    mutable std::vector<T> m_runValue;
 };
 
 // initialize the TEMPI grid property using the temperature vs depth
@@ -70,13 +70,34 @@ namespace Opm {
         MULTREGTScanner(const Eclipse3DProperties& e3DProps,
                         const std::vector< const DeckKeyword* >& keywords);
         double getRegionMultiplier(size_t globalCellIdx1, size_t globalCellIdx2, FaceDir::DirEnum faceDir) const;
+        std::vector<double> getRegionMultipliers(const std::vector<size_t>& globalCellIdx1,
+                                                 const std::vector<size_t>& globalCellIdx2,
+                                                 FaceDir::DirEnum faceDir) const;
+        bool hasRegionMultipliers() const;
 
     private:
+        /*
+          The search map compiled for one region keyword: the region values
+          which occur in the MULTREGT records are numbered 0,1,2,... and
+          cell_region holds this number for every cell, or -1 if the region
+          of the cell is not mentioned in any record. The record_index table
+          is a dense num_regions x num_regions matrix with the index of the
+          MULTREGT record in m_records, or -1.
+        */
+        struct RegionTable {
+            std::vector<int> cell_region;
+            std::size_t num_regions;
+            std::vector<int> record_index;
+        };
+
         void addKeyword( const Eclipse3DProperties& props, const DeckKeyword& deckKeyword, const std::string& defaultRegion);
         void assertKeywordSupported(const DeckKeyword& deckKeyword, const std::string& defaultRegion);
+        void compileSearchMap(const Eclipse3DProperties& props);
         std::vector< MULTREGTRecord > m_records;
         std::map<std::string , MULTREGTSearchMap> m_searchMap;
-        const Eclipse3DProperties& m_e3DProps;
+        std::vector< RegionTable > m_regionTables;
+        size_t m_nx = 0;
+        size_t m_ny = 0;
     };
 
 }
@@ -19,6 +19,9 @@
 #ifndef ECLIPSE_SATFUNCPROPERTY_INITIALIZERS_HPP
 #define ECLIPSE_SATFUNCPROPERTY_INITIALIZERS_HPP
 
+#include <map>
+#include <mutex>
+#include <set>
 #include <vector>
 #include <string>
 
@@ -29,6 +32,53 @@ namespace Opm {
     class EclipseGrid;
     class TableManager;
 
+    /*
+      Computes the endpoint arrays of several keywords, e.g. SWL, SWCR and
+      ISWL, in one pass over the cells; the endpoints of the saturation
+      tables are found once. The result holds one array for each keyword,
+      in the order of the keywords. The XXXEndpoint() functions below
+      compute one keyword each.
+    */
+    std::vector<std::vector<double>> satfuncEndpoints(const std::vector<std::string>& keywords,
+                                                      size_t,
+                                                      const TableManager*,
+                                                      const EclipseGrid*,
+                                                      const GridProperties<int>*);
+
+    /*
+      The endpoint arrays of the endpoint keywords announced with
+      request(), computed in one satfuncEndpoints() pass when the first of
+      them is needed. request() takes grid property names, e.g. SWLX or
+      SWLPC are served by the SWL endpoint, and ignores other keywords. The
+      array of a keyword is handed out - and dropped from the cache - on
+      the first request; keywords which have not been announced, or which
+      have already been handed out, are computed on their own. The cache
+      therefore only holds the arrays which have been asked for and not
+      yet collected. numPasses() is the number of passes over the grid so
+      far. The cache can be used from several threads.
+    */
+    class SatfuncEndpointCache {
+    public:
+        SatfuncEndpointCache(const TableManager*,
+                             const EclipseGrid*,
+                             const GridProperties<int>*);
+
+        void request(const std::vector<std::string>& keywords);
+        std::vector<double> get(const std::string& keyword, size_t size);
+        size_t numPasses() const;
+
+    private:
+        void evaluateRequested(size_t size);
+
+        const TableManager* m_tableManager;
+        const EclipseGrid* m_eclipseGrid;
+        const GridProperties<int>* m_intGridProperties;
+        mutable std::mutex m_mutex;
+        size_t m_numPasses = 0;
+        std::set<std::string> m_requested;
+        std::map<std::string, std::vector<double>> m_values;
+    };
+
     std::vector<double> SGLEndpoint(size_t,
                                     const TableManager*,
                                     const EclipseGrid*,
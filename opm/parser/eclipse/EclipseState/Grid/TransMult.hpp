@@ -33,6 +33,7 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/MULTREGTScanner.hpp>
@@ -51,6 +52,32 @@ namespace Opm {
         double getMultiplier(size_t globalIndex, FaceDir::DirEnum faceDir) const;
         double getMultiplier(size_t i , size_t j , size_t k, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplier( size_t globalCellIndex1, size_t globalCellIndex2, FaceDir::DirEnum faceDir) const;
+        std::vector<double> getRegionMultipliers( const std::vector<size_t>& globalCellIndex1,
+                                                  const std::vector<size_t>& globalCellIndex2,
+                                                  FaceDir::DirEnum faceDir) const;
+
+        /*
+          Will return the multipliers for all the cells in the grid for one
+          face direction, i.e. the same values as getMultiplier(g, faceDir)
+          for g = 0,..,nx*ny*nz-1.
+        */
+        std::vector<double> getMultipliers(FaceDir::DirEnum faceDir) const;
+
+        /*
+          Will fill the multipliers for all six face directions, with the
+          MULTREGT multipliers folded in, into one array of size
+          6*nx*ny*nz. The multipliers for direction d are stored in the
+          range [faceIndex(d)*nx*ny*nz, (faceIndex(d) + 1)*nx*ny*nz), with
+          the directions ordered as XPlus, XMinus, YPlus, YMinus, ZPlus and
+          ZMinus. The MULTREGT multiplier between a cell and its cartesian
+          neighbour in the positive direction is applied to the XPlus,
+          YPlus and ZPlus faces only, so that the product of the multipliers
+          on the two sides of a face counts it once.
+        */
+        void getFaceMultipliers(std::vector<double>& multipliers) const;
+        std::vector<double> getFaceMultipliers() const;
+        static size_t faceIndex(FaceDir::DirEnum faceDir);
+
         void applyMULT(const GridProperty<double>& srcMultProp, FaceDir::DirEnum faceDir);
         void applyMULTFLT(const FaultCollection& faults);
         void applyMULTFLT(const Fault& fault);
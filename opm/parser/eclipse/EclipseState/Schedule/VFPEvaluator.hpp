@@ -0,0 +1,177 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_VFP_EVALUATOR_HPP
+#define OPM_VFP_EVALUATOR_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/VFPInjTable.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.hpp>
+
+namespace Opm {
+
+/*
+  The result of evaluating a VFP table: the value, i.e. the bhp or the
+  thp, and the derivatives with respect to the surface rates and with
+  respect to the other pressure.
+*/
+struct VFPEvaluation {
+    double value = 0;
+    double dwat = 0;
+    double doil = 0;
+    double dgas = 0;
+    double dpressure = 0;
+};
+
+
+/*
+  An axis of a VFP table, with the reciprocal interval widths stored so
+  the interpolation factor is one multiplication. Values outside the
+  axis are extrapolated linearly from the end intervals.
+*/
+class VFPAxis {
+public:
+    VFPAxis() = default;
+    explicit VFPAxis(const std::vector<double>& values);
+
+    std::size_t size() const;
+
+    /*
+      Finds the interval of value, and the position of value in that
+      interval: value = x[index] + factor * (x[index + 1] - x[index]).
+      For an axis with only one value the index and factor are zero.
+    */
+    void find(double value, std::size_t& index, double& factor, double& inv_width) const;
+
+private:
+    std::vector<double> m_values;
+    std::vector<double> m_inv_width;
+};
+
+
+/*
+  The VFPProdEvaluator class evaluates a VFPPROD table by multilinear
+  interpolation. The table data is copied to one flat array with the
+  FLO axis innermost, i.e. in the same order as the VFPPROD keyword.
+
+  The rates are surface rates in SI units, positive for production. The
+  derivatives of the FLO, WFR and GFR values with respect to the rates
+  are included in the rate derivatives; a ratio with a zero denominator
+  is taken to be zero.
+
+  The batch versions evaluate many wells in one call, and run in
+  parallel when the number of wells is large. For the thp() methods the
+  derivative dpressure is the derivative with respect to the bhp, for
+  the bhp() methods it is the derivative with respect to the thp.
+*/
+class VFPProdEvaluator {
+public:
+    explicit VFPProdEvaluator(const VFPProdTable& table);
+
+    VFPEvaluation bhp(double wat, double oil, double gas, double thp, double alq) const;
+    VFPEvaluation thp(double wat, double oil, double gas, double bhp, double alq) const;
+
+    void bhp(std::size_t num_wells, const double* wat, const double* oil, const double* gas,
+             const double* thp, const double* alq, VFPEvaluation* result) const;
+    void thp(std::size_t num_wells, const double* wat, const double* oil, const double* gas,
+             const double* bhp, const double* alq, VFPEvaluation* result) const;
+
+private:
+    /*
+      The position of a well in the WFR, GFR, ALQ and FLO axes, and the
+      derivatives of the axis values with respect to the rates.
+    */
+    struct Coordinates {
+        std::size_t offset;
+        double factor[4];
+        double inv_width[4];
+        double dwat[4];
+        double doil[4];
+        double dgas[4];
+    };
+
+    Coordinates coordinates(double wat, double oil, double gas, double alq) const;
+    VFPEvaluation bhp(const Coordinates& coord, double thp) const;
+    VFPEvaluation thp(const Coordinates& coord, double bhp, std::vector<VFPEvaluation>& bhp_values) const;
+    VFPEvaluation rateDerivatives(const Coordinates& coord, double value, const double* derivative) const;
+
+    VFPProdTable::FLO_TYPE m_flo_type;
+    VFPProdTable::WFR_TYPE m_wfr_type;
+    VFPProdTable::GFR_TYPE m_gfr_type;
+
+    VFPAxis m_thp_axis;
+    VFPAxis m_wfr_axis;
+    VFPAxis m_gfr_axis;
+    VFPAxis m_alq_axis;
+    VFPAxis m_flo_axis;
+
+    std::vector<double> m_thp_values;
+    std::size_t m_stride[5];
+    std::size_t m_step[5];
+    std::vector<double> m_data;
+};
+
+
+/*
+  The VFPInjEvaluator class evaluates a VFPINJ table, see the
+  VFPProdEvaluator for the conventions. The rates are positive for
+  injection.
+*/
+class VFPInjEvaluator {
+public:
+    explicit VFPInjEvaluator(const VFPInjTable& table);
+
+    VFPEvaluation bhp(double wat, double oil, double gas, double thp) const;
+    VFPEvaluation thp(double wat, double oil, double gas, double bhp) const;
+
+    void bhp(std::size_t num_wells, const double* wat, const double* oil, const double* gas,
+             const double* thp, VFPEvaluation* result) const;
+    void thp(std::size_t num_wells, const double* wat, const double* oil, const double* gas,
+             const double* bhp, VFPEvaluation* result) const;
+
+private:
+    struct Coordinates {
+        std::size_t offset;
+        double factor;
+        double inv_width;
+        double dwat;
+        double doil;
+        double dgas;
+    };
+
+    Coordinates coordinates(double wat, double oil, double gas) const;
+    VFPEvaluation bhp(const Coordinates& coord, double thp) const;
+    VFPEvaluation thp(const Coordinates& coord, double bhp, std::vector<VFPEvaluation>& bhp_values) const;
+
+    VFPInjTable::FLO_TYPE m_flo_type;
+
+    VFPAxis m_thp_axis;
+    VFPAxis m_flo_axis;
+
+    std::vector<double> m_thp_values;
+    std::size_t m_stride[2];
+    std::size_t m_step[2];
+    std::vector<double> m_data;
+};
+
+}
+
+#endif
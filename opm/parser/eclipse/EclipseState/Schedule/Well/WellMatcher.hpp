@@ -0,0 +1,84 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef WELL_MATCHER_HPP
+#define WELL_MATCHER_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm {
+
+/*
+  The WellMatcher class keeps track of the well names in the order they have
+  been defined, and resolves well name patterns to insertion indices. Patterns
+  without a '*' are resolved with a hash lookup, whereas patterns with a '*'
+  are compiled once and the list of matching wells is cached. When new wells
+  are added only the new wells are tested against the cached patterns, so
+  repeatedly matching the same pattern is O(1) amortized instead of a full
+  scan over all wells.
+
+  The cache is updated from const member functions and protected with a
+  mutex, i.e. it is safe to call match() concurrently.
+*/
+
+class WellMatcher {
+public:
+    WellMatcher() = default;
+    WellMatcher(const WellMatcher& other);
+    WellMatcher& operator=(const WellMatcher& other);
+
+    void addWell(const std::string& well);
+    bool hasWell(const std::string& well) const;
+    std::size_t size() const;
+
+    std::vector<std::size_t> match(const std::string& pattern) const;
+
+private:
+    class Pattern {
+    public:
+        explicit Pattern(const std::string& pattern);
+        bool match(const std::string& well) const;
+        void update(const std::vector<std::string>& wells);
+
+        const std::vector<std::size_t>& matches() const;
+    private:
+        enum class Kind {
+            ALL,
+            PREFIX,
+            GLOB
+        };
+
+        Kind kind;
+        std::string text;
+        std::size_t num_scanned = 0;
+        std::vector<std::size_t> matching;
+    };
+
+    std::vector<std::string> wells;
+    std::unordered_map<std::string, std::size_t> well_index;
+    mutable std::unordered_map<std::string, Pattern> patterns;
+    mutable std::mutex pattern_lock;
+};
+
+}
+
+#endif
@@ -0,0 +1,93 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PVTX_EVALUATOR_HPP
+#define OPM_PVTX_EVALUATOR_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/EclipseState/Tables/PvtxTable.hpp>
+
+namespace Opm {
+
+/*
+  The PvtxEvaluator class is a compiled form of one PVTO or PVTG region
+  table. The undersaturated tables are packed into one ragged array with
+  an offset for each outer node, i.e. for each Rs value of PVTO and each
+  gas pressure of PVTG. The rows of each undersaturated table are stored
+  with increasing argument, and the reciprocal interval widths of the
+  outer nodes and the slopes of the value columns are computed when the
+  evaluator is created.
+
+  The evaluation agrees with PvtxTable::evaluate(): linear interpolation
+  in the undersaturated tables and between the outer nodes, and constant
+  extrapolation beyond the ends of the tables. For PVTO the outer
+  argument is Rs and the inner argument is the pressure, for PVTG the
+  outer argument is the gas pressure and the inner argument is Rv.
+*/
+class PvtxEvaluator {
+public:
+    explicit PvtxEvaluator(const PvtxTable& table);
+
+    /*
+      The value columns are the columns of the undersaturated tables
+      after the argument, i.e. BO and MU for PVTO and BG and MUG for
+      PVTG.
+    */
+    std::size_t numValueColumns() const;
+    std::size_t valueColumnIndex(const std::string& column) const;
+
+    double evaluate(std::size_t column, double outerArg, double innerArg) const;
+    double evaluate(const std::string& column, double outerArg, double innerArg) const;
+
+    /*
+      Evaluates the formation volume factor and the viscosity, the first
+      and second value columns, for n pairs of arguments. The batch runs
+      in parallel when n is large.
+    */
+    void evaluate(std::size_t n, const double* outerArg, const double* innerArg,
+                  double* fvf, double* viscosity) const;
+
+private:
+    std::size_t findOuter(double outerArg, double& weight) const;
+    std::size_t findInner(std::size_t node, double innerArg, double& dx) const;
+
+    std::vector<std::string> m_columnNames;
+    std::size_t m_numValues;
+
+    std::vector<double> m_outer;
+    std::vector<double> m_outerInvWidth;
+
+    /*
+      The undersaturated rows of outer node j are the rows m_offset[j] to
+      m_offset[j + 1]. Row r has the argument m_arg[r], the values
+      m_values[r * m_numValues + c] and, except for the last row of each
+      node, the slopes m_slopes[r * m_numValues + c] to the next row.
+    */
+    std::vector<std::size_t> m_offset;
+    std::vector<double> m_arg;
+    std::vector<double> m_values;
+    std::vector<double> m_slopes;
+};
+
+}
+
+#endif
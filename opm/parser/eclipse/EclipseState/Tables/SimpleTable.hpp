@@ -38,11 +38,25 @@ namespace Opm {
         SimpleTable() = default;
         SimpleTable(TableSchema, const DeckItem& deckItem);
         explicit SimpleTable( TableSchema );
+        SimpleTable( const SimpleTable& other );
+        SimpleTable& operator=( const SimpleTable& other );
         void addColumns();
         void init(const DeckItem& deckItem );
         size_t numColumns() const;
         size_t numRows() const;
         void addRow( const std::vector<double>& row);
+
+        /*
+          Moves the values of all the columns into one contiguous buffer
+          owned by the table, column c starting at packedData() + c *
+          numRows(). Tables read from the deck with init() are packed when
+          they are complete; a table built with addRow() or through the
+          non const getColumn() is packed by calling pack(). Any non const
+          access to the columns unpacks the table again, and packedData()
+          returns nullptr for a table which is not packed.
+        */
+        void pack();
+        const double* packedData() const;
         const TableColumn& getColumn(const std::string &name) const;
         const TableColumn& getColumn(size_t colIdx) const;
         bool hasColumn(const std::string& name) const;
@@ -60,6 +74,19 @@ namespace Opm {
          */
         double evaluate(const std::string& columnName, double xPos) const;
 
+        /*!
+         * \brief Evaluate a column, identified by the index returned from
+         *        getColumnIndex(), at one or many positions.
+         *
+         * Resolve the column once with getColumnIndex() when the table is
+         * evaluated repeatedly; the batch versions are fastest when the
+         * positions are sorted.
+         */
+        size_t getColumnIndex(const std::string& columnName) const;
+        double evaluate(size_t columnIndex, double xPos) const;
+        void evaluate(size_t columnIndex, const double* xPos, double* values, size_t n) const;
+        std::vector<double> evaluate(const std::string& columnName, const std::vector<double>& xPos) const;
+
         /// throws std::invalid_argument if jf != m_jfunc
         void assertJFuncPressure(const bool jf) const;
 
@@ -67,6 +94,11 @@ namespace Opm {
         TableSchema m_schema;
         OrderedMap<std::string, TableColumn> m_columns;
         bool m_jfunc = false;
+
+    private:
+        void unpack();
+
+        std::vector<double> m_data;
     };
 }
 
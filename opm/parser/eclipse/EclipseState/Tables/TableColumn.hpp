@@ -32,6 +32,7 @@ namespace Opm {
     class TableColumn {
     public:
         explicit TableColumn( const ColumnSchema& schema );
+        TableColumn( const TableColumn& other );
         size_t size( ) const;
         const std::string& name() const;
         void assertOrder(double value1 , double value2) const;
@@ -53,23 +54,52 @@ namespace Opm {
         */
         TableIndex lookup(double argValue) const;
         double eval( const TableIndex& index) const;
+
+        /*
+           Batch version of valueColumn.eval( lookup( argValues[i] )) for
+           i = 0,...,n-1, with identical results. The interval found for
+           one argument is tried first for the next, so sorted arguments
+           avoid the binary search.
+        */
+        void lookupEval(const double* argValues, size_t n, const TableColumn& valueColumn, double* values) const;
         void applyDefaults( const TableColumn& argColumn );
         void assertUnitRange() const;
         TableColumn& operator= (const TableColumn& other);
 
         std::vector<double> vectorCopy() const;
-        std::vector<double>::const_iterator begin() const;
-        std::vector<double>::const_iterator end() const;
+        const double* begin() const;
+        const double* end() const;
     private:
+        friend class SimpleTable;
+
+        const double* values() const;
+        void ownValues();
         void assertUpdate(size_t index, double value) const;
         void assertPrevious(size_t index , double value) const;
         void assertNext(size_t index , double value) const;
+        void assertLookup() const;
+        void updateExtrema();
+        size_t lookupInterval(double argValue) const;
+        size_t lookupInterval(double argValue, size_t hint) const;
 
         ColumnSchema m_schema;
-        std::string m_name;
         std::vector<double> m_values;
+
+        /*
+           When the column is part of a packed SimpleTable the values live
+           in the buffer of the table, m_packed points to them and
+           m_values is empty. A copy of the column always owns its values.
+        */
+        const double* m_packed = nullptr;
         std::vector<bool> m_default;
         size_t m_defaultCount;
+
+        /*
+           Index of the first occurence of the minimum and maximum of the
+           values which are not defaulted.
+        */
+        size_t m_minIndex = 0;
+        size_t m_maxIndex = 0;
     };
 
 
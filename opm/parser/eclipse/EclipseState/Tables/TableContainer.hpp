@@ -23,6 +23,7 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <vector>
 
 namespace Opm {
 
@@ -57,6 +58,11 @@ namespace Opm {
 
             container.getTable( 0 ) == container[9] == table0;
             container.gteTable(10 ) ==> exception
+
+         The N - 1 fallback is resolved when the tables are added, so
+         getTable() is a plain array lookup. The getPackedTable() method
+         gives direct access to the contiguous column buffer owned by a
+         packed SimpleTable, see SimpleTable::pack().
         */
     public:
         explicit TableContainer( size_t maxTables );
@@ -77,6 +83,24 @@ namespace Opm {
         const SimpleTable& getTable(size_t tableNumber) const;
         const SimpleTable& operator[](size_t tableNumber) const;
 
+        /*
+          Column c of a packed table is found at data + c * numRows, the
+          data is owned by the table. Defaulted values are stored as they
+          are in the TableColumn. Throws std::logic_error if the table is
+          not packed.
+        */
+        struct PackedTable {
+            const double* data;
+            size_t numRows;
+            size_t numColumns;
+
+            const double* column(size_t columnIndex) const {
+                return data + columnIndex * numRows;
+            }
+        };
+
+        PackedTable getPackedTable(size_t tableNumber) const;
+
         template <class TableType>
         const TableType& getTable(size_t tableNumber) const {
             const SimpleTable &simpleTable = getTable( tableNumber );
@@ -85,8 +109,18 @@ namespace Opm {
         }
 
     private:
+        size_t resolveTableNumber(size_t tableNumber) const;
+
         size_t m_maxTables;
         std::map<size_t , std::shared_ptr<const SimpleTable> > m_tables;
+
+        /*
+          For each of the m_maxTables slots: the number of the table which
+          should be used, or m_maxTables if there is no table in the range
+          0...slot, and a pointer to that table.
+        */
+        std::vector<size_t> m_resolved;
+        std::vector<const SimpleTable*> m_lookup;
     };
 
 }
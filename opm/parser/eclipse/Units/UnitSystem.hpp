@@ -20,6 +20,7 @@
 #ifndef UNITSYSTEM_H
 #define UNITSYSTEM_H
 
+#include <cstddef>
 #include <string>
 #include <map>
 #include <vector>
@@ -93,10 +94,39 @@ namespace Opm {
 
         Dimension parse(const std::string& dimension) const;
 
+        /*
+          The conversion of one measure between SI and this unit system.
+          The conversion from SI is factor * (value - offset), the
+          conversion to SI is factor * value + offset; the same
+          expressions as the scalar from_si() and to_si(). The conversion
+          can be looked up once and then applied to any number of values,
+          also from several threads.
+        */
+        struct Conversion {
+            double factor;
+            double offset;
+            bool from_si;
+
+            double operator()( double value ) const {
+                if (this->from_si)
+                    return this->factor * (value - this->offset);
+
+                return this->factor * value + this->offset;
+            }
+
+            /* The input and output arrays can be the same array. */
+            void operator()( const double* input, double* output, std::size_t size ) const;
+        };
+
+        Conversion from_si_conversion( measure ) const;
+        Conversion to_si_conversion( measure ) const;
+
         double from_si( measure, double ) const;
         double to_si( measure, double ) const;
         void from_si( measure, std::vector<double>& ) const;
         void to_si( measure, std::vector<double>& ) const;
+        void from_si( measure, const double* input, double* output, std::size_t size ) const;
+        void to_si( measure, const double* input, double* output, std::size_t size ) const;
         const char* name( measure ) const;
 
         static ert_ecl_unit_enum ecl_units(UnitType opm_unit);
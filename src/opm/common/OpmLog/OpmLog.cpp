@@ -21,6 +21,7 @@
 #include <opm/common/OpmLog/Logger.hpp>
 #include <opm/common/OpmLog/StreamLog.hpp>
 #include <iostream>
+#include <mutex>
 #include <errno.h>  // For errno
 #include <stdio.h>  // For fileno() and stdout
 
@@ -53,6 +54,13 @@ namespace Opm {
                 return isatty(file_descriptor);
             }
         }
+
+        /*
+          Messages can be added from several threads, e.g. when the
+          EclipseState is constructed in parallel; the backends are not
+          thread safe so the message handling is serialized.
+        */
+        std::mutex message_lock;
     }
 
 
@@ -65,12 +73,14 @@ namespace Opm {
 
 
     void OpmLog::addMessage(int64_t messageFlag , const std::string& message) {
+        std::lock_guard<std::mutex> lock(message_lock);
         if (m_logger)
             m_logger->addMessage( messageFlag , message );
     }
 
 
     void OpmLog::addTaggedMessage(int64_t messageFlag, const std::string& tag, const std::string& message) {
+        std::lock_guard<std::mutex> lock(message_lock);
         if (m_logger)
             m_logger->addTaggedMessage( messageFlag, tag, message );
     }
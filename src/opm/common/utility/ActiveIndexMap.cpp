@@ -0,0 +1,114 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <numeric>
+
+#include <opm/common/utility/ActiveIndexMap.hpp>
+
+namespace Opm {
+
+ActiveIndexMap::ActiveIndexMap(std::size_t global_size) :
+    ActiveIndexMap(global_size, nullptr)
+{}
+
+
+ActiveIndexMap::ActiveIndexMap(const std::vector<int>& actnum) :
+    ActiveIndexMap(actnum.size(), actnum.data())
+{}
+
+
+/*
+  If the actnum pointer is nullptr all cells are active, otherwise the cells
+  with actnum > 0 are active.
+*/
+ActiveIndexMap::ActiveIndexMap(std::size_t global_size, const int* actnum) :
+    global_to_active(global_size)
+{
+    if (actnum == nullptr) {
+        this->active_to_global.resize(global_size);
+        std::iota(this->global_to_active.begin(), this->global_to_active.end(), 0);
+        std::iota(this->active_to_global.begin(), this->active_to_global.end(), 0);
+        return;
+    }
+
+    int active_index = 0;
+    for (std::size_t global_index = 0; global_index < global_size; global_index++) {
+        if (actnum[global_index] > 0) {
+            this->global_to_active[global_index] = active_index++;
+            this->active_to_global.push_back(static_cast<int>(global_index));
+        } else
+            this->global_to_active[global_index] = -1;
+    }
+}
+
+
+std::size_t ActiveIndexMap::globalSize() const {
+    return this->global_to_active.size();
+}
+
+
+std::size_t ActiveIndexMap::activeSize() const {
+    return this->active_to_global.size();
+}
+
+
+bool ActiveIndexMap::allActive() const {
+    return this->activeSize() == this->globalSize();
+}
+
+
+bool ActiveIndexMap::isActive(std::size_t global_index) const {
+    return this->global_to_active.at(global_index) >= 0;
+}
+
+
+/*
+  Will return -1 for inactive cells, and throw std::out_of_range if the
+  global index is invalid.
+*/
+int ActiveIndexMap::activeIndex(std::size_t global_index) const {
+    return this->global_to_active.at(global_index);
+}
+
+
+int ActiveIndexMap::globalIndex(std::size_t active_index) const {
+    return this->active_to_global.at(active_index);
+}
+
+
+const std::vector<int>& ActiveIndexMap::globalToActive() const {
+    return this->global_to_active;
+}
+
+
+const std::vector<int>& ActiveIndexMap::activeToGlobal() const {
+    return this->active_to_global;
+}
+
+
+bool ActiveIndexMap::operator==(const ActiveIndexMap& other) const {
+    return this->global_to_active == other.global_to_active;
+}
+
+
+bool ActiveIndexMap::operator!=(const ActiveIndexMap& other) const {
+    return !(*this == other);
+}
+
+}
@@ -41,6 +41,7 @@
 #include <vector>
 #include <map>
 #include <cmath>
+#include <algorithm>
 
 using namespace std;
 
@@ -120,6 +121,7 @@ read(const std::string & datafilename, int xColumn, int fColumn)
 {
   data.clear() ;
   ddata.clear() ;
+  updateFlatData() ;
 
   ifstream datafile_fs(datafilename.c_str());
   if (!datafile_fs) {
@@ -187,49 +189,140 @@ evaluate(double x) const {
     throw("MonotCubicInterpolator: evaluate() received inf/nan input.");
   }
 
-  // xf becomes the first (xdata,fdata) pair where xdata >= x
-  map<double,double>::const_iterator xf_iterator = data.lower_bound(x);
+  // Constant extrapolation (!!) outside [x_min, x_max], this is also
+  // where x is on the lower interval limit.
+  if (x <= xvalues.front()) {
+    return fvalues.front();
+  }
+  if (x > xvalues.back()) {
+    return fvalues.back();
+  }
+
+  // Ok, we have x_min < x <= x_max
+  const size_t i = findInterval(x, 0);
+  const double x1 = xvalues[i];
+
+  // Linear interpolation if derivative data is not available:
+  if (dvalues.empty()) {
+    return fvalues[i] + slopes[i] * (x - x1);
+  }
+  else { // Do Cubic Hermite spline
+    double t = (x - x1)/(xvalues[i+1] - x1); // t \in [0,1]
+    double h = xvalues[i+1] - x1;
+    double finterp
+      = fvalues[i]   * H00(t)
+      + dvalues[i]   * H10(t) * h
+      + fvalues[i+1] * H01(t)
+      + dvalues[i+1] * H11(t) * h ;
+    return finterp;
+  }
+
+}
+
 
-  // First check if we must extrapolate:
-  if (xf_iterator == data.begin()) {
-    if (data.begin()->first == x) { // Just on the interval limit
-      return data.begin()->second;
+/*
+  The interval of the previous value is checked before searching, so
+  for sorted input each value costs one or two comparisons in addition
+  to the interpolation itself.
+*/
+void
+MonotCubicInterpolator::
+evaluate(const double* x, double* out, size_t n) const {
+
+  if (xvalues.size() < 2) {
+    for (size_t k = 0; k < n; ++k) {
+      out[k] = evaluate(x[k]);
+    }
+    return;
+  }
+
+  const double* xv = xvalues.data();
+  const double* fv = fvalues.data();
+  const double* dv = dvalues.data();
+  const double* sv = slopes.data();
+  const bool linear = dvalues.empty();
+  size_t i = 0;
+
+  for (size_t k = 0; k < n; ++k) {
+    const double xk = x[k];
+    if (std::isnan(xk) || std::isinf(xk)) {
+      throw("MonotCubicInterpolator: evaluate() received inf/nan input.");
+    }
+
+    // Constant extrapolation (!!)
+    if (xk <= xvalues.front()) {
+      out[k] = fvalues.front();
+      continue;
+    }
+    if (xk > xvalues.back()) {
+      out[k] = fvalues.back();
+      continue;
+    }
+
+    if (!(xv[i] < xk && xk <= xv[i+1])) {
+      i = findInterval(xk, i);
+    }
+
+    if (linear) {
+      out[k] = fv[i] + sv[i] * (xk - xv[i]);
     }
     else {
-      // Constant extrapolation (!!)
-      return data.begin()->second;
+      double t = (xk - xv[i])/(xv[i+1] - xv[i]);
+      double h = xv[i+1] - xv[i];
+      out[k]
+        = fv[i]   * H00(t)
+        + dv[i]   * H10(t) * h
+        + fv[i+1] * H01(t)
+        + dv[i+1] * H11(t) * h ;
     }
   }
-  if (xf_iterator == data.end()) {
-      // Constant extrapolation (!!)
-      return data.rbegin()->second;
-  }
+}
 
 
-  // Ok, we have x_min < x < x_max
+size_t
+MonotCubicInterpolator::
+findInterval(double x, size_t hint) const {
+  const size_t last = xvalues.size() - 2;
 
-  pair<double,double> xf2 = *xf_iterator;
-  pair<double,double> xf1 = *(--xf_iterator);
-  // we now have: xf2.first > x
+  if (hint <= last && xvalues[hint] < x && x <= xvalues[hint+1]) {
+    return hint;
+  }
+  if (hint < last && xvalues[hint+1] < x && x <= xvalues[hint+2]) {
+    return hint + 1;
+  }
 
-  // Linear interpolation if derivative data is not available:
-  if (ddata.size() != data.size()) {
-    double finterp =  xf1.second +
-      (xf2.second - xf1.second) / (xf2.first - xf1.first)
-      * (x - xf1.first);
-    return finterp;
+  // The first x value >= x is the right end of the interval.
+  const size_t upper = lower_bound(xvalues.begin(), xvalues.end(), x) - xvalues.begin();
+  if (upper == 0) {
+    return 0;
   }
-  else { // Do Cubic Hermite spline
-    double t = (x - xf1.first)/(xf2.first - xf1.first); // t \in [0,1]
-    double h = xf2.first - xf1.first;
-    double finterp
-      = xf1.second       * H00(t)
-      + ddata[xf1.first] * H10(t) * h
-      + xf2.second       * H01(t)
-      + ddata[xf2.first] * H11(t) * h ;
-    return finterp;
+  return std::min(upper - 1, last);
+}
+
+
+void
+MonotCubicInterpolator::
+updateFlatData() const {
+  xvalues.clear();
+  fvalues.clear();
+  dvalues.clear();
+  slopes.clear();
+
+  for (map<double,double>::const_iterator it = data.begin(); it != data.end(); ++it) {
+    xvalues.push_back(it->first);
+    fvalues.push_back(it->second);
   }
 
+  if (ddata.size() == data.size()) {
+    for (map<double,double>::const_iterator it = ddata.begin(); it != ddata.end(); ++it) {
+      dvalues.push_back(it->second);
+    }
+  }
+  else {
+    for (size_t i = 0; i + 1 < xvalues.size(); ++i) {
+      slopes.push_back((fvalues[i+1] - fvalues[i]) / (xvalues[i+1] - xvalues[i]));
+    }
+  }
 }
 
 
@@ -387,6 +480,7 @@ computeInternalFunctionData() const {
 
   /* The contents of this function is meaningless if there is only one datapoint */
   if (data.size() <= 1) {
+    updateFlatData();
     return;
   }
 
@@ -487,6 +581,7 @@ computeInternalFunctionData() const {
 
   strictlyMonotoneCached = true;
   monotoneCached = true;
+  updateFlatData();
 }
 
 //       Checks if the function curve is flat (zero derivative) at the
@@ -612,6 +707,7 @@ shrinkFlatAreas(const double epsilon) {
         }
     }
 
+    updateFlatData();
 }
 
 
@@ -725,6 +821,7 @@ scaleData(double factor) {
       it->second  *= factor ;
     }
   }
+  updateFlatData();
 }
 
 
@@ -0,0 +1,229 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <opm/common/utility/numeric/calculateCellGeometry.hpp>
+
+namespace Opm {
+
+namespace {
+
+/*
+  The volume formula from calculateCellVol(): the sum over the permutations
+  of (X,Y,Z) of products of the C() coefficients is the determinant of the
+  3x3 matrix formed by the coefficient vectors, i.e. the volume is a
+  weighted sum of 64 determinants. The corners of the cell are found at
+  x[c*stride], y[c*stride] and z[c*stride] for c = 0,..,7.
+*/
+
+inline double cellVolume(const double* x, const double* y, const double* z, std::size_t stride) {
+    double cx[8], cy[8], cz[8];
+    const double* r[3] = {x, y, z};
+    double* c[3] = {cx, cy, cz};
+
+    for (int d = 0; d < 3; d++) {
+        const double r0 = r[d][0];
+        const double r1 = r[d][1*stride];
+        const double r2 = r[d][2*stride];
+        const double r3 = r[d][3*stride];
+        const double r4 = r[d][4*stride];
+        const double r5 = r[d][5*stride];
+        const double r6 = r[d][6*stride];
+        const double r7 = r[d][7*stride];
+
+        c[d][0] = r0;                                  // C(0,0,0)
+        c[d][1] = r1 - r0;                             // C(1,0,0)
+        c[d][2] = r2 - r0;                             // C(0,1,0)
+        c[d][3] = r3 + r0 - r2 - r1;                   // C(1,1,0)
+        c[d][4] = r4 - r0;                             // C(0,0,1)
+        c[d][5] = r5 + r0 - r4 - r1;                   // C(1,0,1)
+        c[d][6] = r6 + r0 - r4 - r2;                   // C(0,1,1)
+        c[d][7] = r7 + r4 + r2 + r1 - r6 - r5 - r3 - r0; // C(1,1,1)
+    }
+
+    double volume = 0;
+    for (int pb = 0; pb < 2; pb++) {
+        for (int pg = 0; pg < 2; pg++) {
+            const int n1 = 1 + 2*pb + 4*pg;
+            for (int qa = 0; qa < 2; qa++) {
+                for (int qg = 0; qg < 2; qg++) {
+                    const int n2 = qa + 2 + 4*qg;
+                    for (int ra = 0; ra < 2; ra++) {
+                        for (int rb = 0; rb < 2; rb++) {
+                            const int n3 = ra + 2*rb + 4;
+                            const double det = cx[n1] * (cy[n2]*cz[n3] - cz[n2]*cy[n3])
+                                             - cy[n1] * (cx[n2]*cz[n3] - cz[n2]*cx[n3])
+                                             + cz[n1] * (cx[n2]*cy[n3] - cy[n2]*cx[n3]);
+                            volume += det / ((qa + ra + 1) * (pb + rb + 1) * (pg + qg + 1));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return std::fabs(volume);
+}
+
+
+/*
+  The corners of the cells in row (j,k) are stored as x[c*nx + i] for
+  corner c of cell i, using the corner numbering of EclipseGrid.
+*/
+
+void gatherRow(std::size_t nx, std::size_t ny, std::size_t j, std::size_t k,
+               const std::vector<double>& coord, const std::vector<double>& zcorn,
+               double* x, double* y, double* z) {
+    for (int c = 0; c < 8; c++) {
+        const std::size_t ic = c & 1;
+        const std::size_t jc = (c >> 1) & 1;
+        const std::size_t kc = c >> 2;
+        const std::size_t zoffset = (2*j + jc) * 2 * nx + (2*k + kc) * 4 * nx * ny + ic;
+        const std::size_t poffset = (j + jc) * (nx + 1) + ic;
+
+        for (std::size_t i = 0; i < nx; i++) {
+            const double* pillar = &coord[6 * (poffset + i)];
+            const double zc = zcorn[zoffset + 2*i];
+            const double dz = pillar[5] - pillar[2];
+            const double t = (dz == 0) ? 0 : (zc - pillar[2]) / dz;
+
+            x[c*nx + i] = pillar[0] + t * (pillar[3] - pillar[0]);
+            y[c*nx + i] = pillar[1] + t * (pillar[4] - pillar[1]);
+            z[c*nx + i] = zc;
+        }
+    }
+}
+
+
+void checkSize(std::size_t nx, std::size_t ny, std::size_t nz,
+               const std::vector<double>& coord,
+               const std::vector<double>& zcorn) {
+    if (coord.size() != 6 * (nx + 1) * (ny + 1))
+        throw std::invalid_argument("Size mismatch for COORD: " + std::to_string(coord.size()));
+
+    if (zcorn.size() != 8 * nx * ny * nz)
+        throw std::invalid_argument("Size mismatch for ZCORN: " + std::to_string(zcorn.size()));
+}
+
+}
+
+
+CellGeometry calculateCellGeometry(std::size_t nx, std::size_t ny, std::size_t nz,
+                                   const std::vector<double>& coord,
+                                   const std::vector<double>& zcorn) {
+    checkSize(nx, ny, nz, coord, zcorn);
+
+    const std::size_t size = nx * ny * nz;
+    CellGeometry geometry;
+    geometry.volume.resize(size);
+    geometry.center_x.resize(size);
+    geometry.center_y.resize(size);
+    geometry.depth.resize(size);
+    geometry.thickness.resize(size);
+
+#pragma omp parallel for
+    for (long k = 0; k < static_cast<long>(nz); k++) {
+        std::vector<double> x(8 * nx), y(8 * nx), z(8 * nx);
+
+        for (std::size_t j = 0; j < ny; j++) {
+            gatherRow(nx, ny, j, k, coord, zcorn, x.data(), y.data(), z.data());
+
+            const std::size_t row_offset = j * nx + k * nx * ny;
+            double* volume = geometry.volume.data() + row_offset;
+            double* center_x = geometry.center_x.data() + row_offset;
+            double* center_y = geometry.center_y.data() + row_offset;
+            double* depth = geometry.depth.data() + row_offset;
+            double* thickness = geometry.thickness.data() + row_offset;
+
+#pragma omp simd
+            for (std::size_t i = 0; i < nx; i++) {
+                double sx = 0, sy = 0, top = 0, bottom = 0;
+                for (int c = 0; c < 4; c++) {
+                    sx += x[c*nx + i] + x[(c + 4)*nx + i];
+                    sy += y[c*nx + i] + y[(c + 4)*nx + i];
+                    top += z[c*nx + i];
+                    bottom += z[(c + 4)*nx + i];
+                }
+
+                center_x[i] = sx / 8;
+                center_y[i] = sy / 8;
+                depth[i] = (top + bottom) / 8;
+                thickness[i] = (bottom - top) / 4;
+                volume[i] = cellVolume(&x[i], &y[i], &z[i], nx);
+            }
+        }
+    }
+
+    return geometry;
+}
+
+
+std::vector<double> calculateCellVolumes(std::size_t nx, std::size_t ny, std::size_t nz,
+                                         const std::vector<double>& coord,
+                                         const std::vector<double>& zcorn) {
+    checkSize(nx, ny, nz, coord, zcorn);
+
+    std::vector<double> volume(nx * ny * nz);
+
+#pragma omp parallel for
+    for (long k = 0; k < static_cast<long>(nz); k++) {
+        std::vector<double> x(8 * nx), y(8 * nx), z(8 * nx);
+
+        for (std::size_t j = 0; j < ny; j++) {
+            gatherRow(nx, ny, j, k, coord, zcorn, x.data(), y.data(), z.data());
+
+            double* row_volume = volume.data() + j * nx + k * nx * ny;
+#pragma omp simd
+            for (std::size_t i = 0; i < nx; i++)
+                row_volume[i] = cellVolume(&x[i], &y[i], &z[i], nx);
+        }
+    }
+
+    return volume;
+}
+
+
+std::vector<double> calculateCellDepths(std::size_t nx, std::size_t ny, std::size_t nz,
+                                        const std::vector<double>& zcorn) {
+    if (zcorn.size() != 8 * nx * ny * nz)
+        throw std::invalid_argument("Size mismatch for ZCORN: " + std::to_string(zcorn.size()));
+
+    std::vector<double> depth(nx * ny * nz);
+
+#pragma omp parallel for
+    for (long k = 0; k < static_cast<long>(nz); k++) {
+        for (std::size_t j = 0; j < ny; j++) {
+            const double* top = zcorn.data() + 2*j * 2 * nx + 2*k * 4 * nx * ny;
+            const double* bottom = top + 4 * nx * ny;
+            double* row_depth = depth.data() + j * nx + k * nx * ny;
+
+#pragma omp simd
+            for (std::size_t i = 0; i < nx; i++)
+                row_depth[i] = (top[2*i] + top[2*i + 1] + top[2*nx + 2*i] + top[2*nx + 2*i + 1]
+                                + bottom[2*i] + bottom[2*i + 1] + bottom[2*nx + 2*i] + bottom[2*nx + 2*i + 1]) / 8;
+        }
+    }
+
+    return depth;
+}
+
+}
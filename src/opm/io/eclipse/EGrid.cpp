@@ -40,26 +40,10 @@ EGrid::EGrid(const std::string &filename) : EclFile(filename)
    nijk[1] = gridhead[2];
    nijk[2] = gridhead[3];
 
-   if (file.hasKey("ACTNUM")) {
-       auto actnum = get<int>("ACTNUM");
-
-       nactive = 0;
-       for (unsigned int i = 0; i < actnum.size(); i++) {
-           if (actnum[i] > 0) {
-               act_index.push_back(nactive);
-               glob_index.push_back(i);
-               nactive++;
-           } else {
-               act_index.push_back(-1);
-           }
-        }
-   } else {
-       int nCells = nijk[0] * nijk[1] * nijk[2];
-       act_index.resize(nCells);
-       glob_index.resize(nCells);
-       std::iota(act_index.begin(), act_index.end(), 0);
-       std::iota(glob_index.begin(), glob_index.end(), 0);
-   }
+   if (file.hasKey("ACTNUM"))
+       active_map = ActiveIndexMap(get<int>("ACTNUM"));
+   else
+       active_map = ActiveIndexMap(nijk[0] * nijk[1] * nijk[2]);
 
    coord_array = get<float>("COORD");
    zcorn_array = get<float>("ZCORN");
@@ -84,17 +68,17 @@ int EGrid::active_index(int i, int j, int k) const
         OPM_THROW(std::invalid_argument, "i, j or/and k out of range");
     }
 
-    return act_index[n];
+    return active_map.globalToActive()[n];
 }
 
 
 std::array<int, 3> EGrid::ijk_from_active_index(int actInd) const
 {
-    if (actInd < 0 || actInd >= nactive) {
+    if (actInd < 0 || actInd >= activeCells()) {
         OPM_THROW(std::invalid_argument, "active index out of range");
     }
 
-    int _glob = glob_index[actInd];
+    int _glob = active_map.activeToGlobal()[actInd];
 
     std::array<int, 3> result;
     result[2] = _glob / (nijk[0] * nijk[1]);
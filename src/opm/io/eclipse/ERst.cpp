@@ -23,6 +23,7 @@
 #include <exception>
 #include <iomanip>
 #include <iterator>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -89,6 +90,40 @@ void ERst::loadReportStepNumber(int number)
 }
 
 
+void ERst::loadReportStepNumber(int number, const std::vector<std::string>& arrays)
+{
+    if (!hasReportStepNumber(number)) {
+        std::string message="Trying to load non existing report step number " + std::to_string(number);
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    std::vector<int> arrayIndexList;
+    for (const auto& name : arrays) {
+        arrayIndexList.push_back(findArrayIndex(name, number));
+    }
+
+    loadData(arrayIndexList);
+
+    // Arrays not in the list are loaded on demand by getRst()
+    reportLoaded[number] = true;
+}
+
+
+void ERst::unloadReportStepNumber(int number)
+{
+    if (!hasReportStepNumber(number)) {
+        std::string message="Trying to unload non existing report step number " + std::to_string(number);
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    for (int i = arrIndexRange[number].first; i < arrIndexRange[number].second; i++) {
+        unloadData(i);
+    }
+
+    reportLoaded[number] = false;
+}
+
+
 std::vector<EclFile::EclEntry> ERst::listOfRstArrays(int reportStepNumber)
 {
     std::vector<EclEntry> list;
@@ -168,6 +203,16 @@ int ERst::getArrayIndex(const std::string& name, int number) const
         OPM_THROW(std::runtime_error, message);
     }
 
+    return findArrayIndex(name, number);
+}
+
+int ERst::findArrayIndex(const std::string& name, int number) const
+{
+    if (!hasReportStepNumber(number)) {
+        std::string message = "Trying to get vector " + name + " from non existing sequence " + std::to_string(number);
+        OPM_THROW(std::invalid_argument, message);
+    }
+
     auto range_it = arrIndexRange.find(number);
 
     std::pair<int,int> indexRange = range_it->second;
@@ -231,4 +276,58 @@ const std::vector<std::string>& ERst::getRst<std::string>(const std::string& nam
     return getImpl(ind, CHAR, char_array, "string");
 }
 
+
+template <typename T>
+std::vector<T> ERst::getRst(const std::string& name, int reportStepNumber, int first, int count)
+{
+    if (count < 0) {
+        std::string message = "Negative number of elements requested from array " + name;
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    std::vector<int> elements(count);
+    std::iota(elements.begin(), elements.end(), first);
+
+    return getElements<T>(findArrayIndex(name, reportStepNumber), elements);
+}
+
+
+template <typename T>
+std::vector<T> ERst::getRst(const std::string& name, int reportStepNumber, const std::vector<int>& elements)
+{
+    return getElements<T>(findArrayIndex(name, reportStepNumber), elements);
+}
+
+
+template <typename T>
+std::vector<std::vector<T>> ERst::getRstTimeSeries(const std::string& name, const std::vector<int>& elements)
+{
+    std::vector<std::vector<T>> series;
+    series.reserve(seqnum.size());
+
+    for (int number : seqnum) {
+        series.push_back(getElements<T>(findArrayIndex(name, number), elements));
+    }
+
+    return series;
+}
+
+template std::vector<int> ERst::getRst<int>(const std::string&, int, int, int);
+template std::vector<float> ERst::getRst<float>(const std::string&, int, int, int);
+template std::vector<double> ERst::getRst<double>(const std::string&, int, int, int);
+template std::vector<bool> ERst::getRst<bool>(const std::string&, int, int, int);
+template std::vector<std::string> ERst::getRst<std::string>(const std::string&, int, int, int);
+
+template std::vector<int> ERst::getRst<int>(const std::string&, int, const std::vector<int>&);
+template std::vector<float> ERst::getRst<float>(const std::string&, int, const std::vector<int>&);
+template std::vector<double> ERst::getRst<double>(const std::string&, int, const std::vector<int>&);
+template std::vector<bool> ERst::getRst<bool>(const std::string&, int, const std::vector<int>&);
+template std::vector<std::string> ERst::getRst<std::string>(const std::string&, int, const std::vector<int>&);
+
+template std::vector<std::vector<int>> ERst::getRstTimeSeries<int>(const std::string&, const std::vector<int>&);
+template std::vector<std::vector<float>> ERst::getRstTimeSeries<float>(const std::string&, const std::vector<int>&);
+template std::vector<std::vector<double>> ERst::getRstTimeSeries<double>(const std::string&, const std::vector<int>&);
+template std::vector<std::vector<bool>> ERst::getRstTimeSeries<bool>(const std::string&, const std::vector<int>&);
+template std::vector<std::vector<std::string>> ERst::getRstTimeSeries<std::string>(const std::string&, const std::vector<int>&);
+
 }} // namespace Opm::ecl
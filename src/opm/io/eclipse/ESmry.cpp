@@ -27,6 +27,7 @@
 #include <unistd.h>
 #include <limits>
 #include <set>
+#include <unordered_map>
 
 #include <opm/io/eclipse/EclFile.hpp>
 
@@ -153,6 +154,11 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
     for (int i = 0; i < nFiles; i++){
         arrayInd.push_back({});
     }
+
+    std::unordered_map<std::string, int> keywIndex;
+    for (const auto& keyw : keywList) {
+        keywIndex.emplace(keyw, static_cast<int>(keywIndex.size()));
+    }
     
     int n = nFiles - 1;
     
@@ -176,14 +182,12 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
 	std::vector<int> tmpVect(keywords.size(), -1);
         arrayInd[n]=tmpVect;
 
-        std::set<std::string>::iterator it;
-
         for (size_t i=0; i < keywords.size(); i++) {
             std::string keyw = makeKeyString(keywords[i], wgnames[i], nums[i]);
-            it = std::find(keywList.begin(), keywList.end(), keyw);
+            auto it = keywIndex.find(keyw);
 
-            if (it != keywList.end()){
-                arrayInd[n][i] = distance(keywList.begin(), it);
+            if (it != keywIndex.end()){
+                arrayInd[n][i] = it->second;
             }
         }
         
@@ -332,9 +336,13 @@ void ESmry::updatePathAndRootName(std::string& dir, std::string& rootN) const {
     };
 }
 
+/*
+  The keyword list is built from a std::set, i.e. it is sorted and can be
+  searched with a binary search.
+*/
 bool ESmry::hasKey(const std::string &key) const
 {
-    return std::find(keyword.begin(), keyword.end(), key) != keyword.end();
+    return std::binary_search(keyword.begin(), keyword.end(), key);
 }
 
 
@@ -410,9 +418,9 @@ std::string ESmry::makeKeyString(const std::string &keyword, const std::string &
 
 const std::vector<float>& ESmry::get(const std::string& name) const
 {
-    auto it = std::find(keyword.begin(), keyword.end(), name);
+    auto it = std::lower_bound(keyword.begin(), keyword.end(), name);
 
-    if (it == keyword.end()) {
+    if (it == keyword.end() || *it != name) {
         std::string message="keyword " + name + " not found ";
         OPM_THROW(std::invalid_argument, message);
     }
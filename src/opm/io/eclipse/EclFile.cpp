@@ -21,12 +21,13 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <fstream>
 #include <iomanip>
-#include <iterator>
-#include <sstream>
+#include <limits>
+#include <numeric>
 #include <string>
 
 #include <opm/common/ErrorMacros.hpp>
@@ -287,18 +288,6 @@ std::vector<std::string> readBinaryCharArray(std::fstream& fileH, const int size
 }
 
 
-std::vector<std::string> split_string(const std::string& inputStr)
-{
-    std::istringstream iss(inputStr);
-
-    std::vector<std::string> tokens {std::istream_iterator<std::string>{iss},
-                                     std::istream_iterator<std::string>{}
-                                    };
-
-    return tokens;
-}
-
-
 void readFormattedHeader(std::fstream& fileH, std::string& arrName,
                          int &num, Opm::EclIO::eclArrType &arrType)
 {
@@ -341,156 +330,589 @@ void readFormattedHeader(std::fstream& fileH, std::string& arrName,
 }
 
 
-template<typename T>
+/*
+  The formatted arrays are read into a buffer in one operation, and the
+  values are converted directly from the buffer. Tokens which are not in
+  the canonical layout written by EclOutput and the simulators are
+  converted with the string based functions convertInte(), convertReal()
+  and convertDoub(), so the resulting values are identical to what
+  std::stoi() and std::stod() would give for all tokens.
+*/
+
+std::vector<char> readFormattedBuffer(std::fstream& fileH, const int size,
+                                      Opm::EclIO::eclArrType arrType)
+{
+    if (!fileH.is_open()) {
+        OPM_THROW(std::runtime_error, "fstream fileH not open for reading");
+    }
+
+    std::vector<char> buffer(sizeOnDiskFormatted(size, arrType));
+    fileH.read(buffer.data(), buffer.size());
+    buffer.resize(fileH.gcount());
+
+    return buffer;
+}
+
+
+inline bool isBlank(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+
+/*
+  Files written with the standard layout, i.e. maxBlockSize values per
+  block, nColumns values per line and values right aligned in columns of
+  width columnWidth, are read column by column: the position of each value
+  in the buffer is computed directly, and the values are converted in
+  parallel. The file is read in chunks of whole blocks through one reused
+  buffer. The function returns false if the file does not have the standard
+  layout, and the caller will then fall back to splitting the array at
+  blanks.
+*/
+
+template<typename T, typename Parse, typename Convert>
+bool readFixedWidthArray(std::fstream& fileH, const int size,
+                         Opm::EclIO::eclArrType arrType, Parse parse,
+                         Convert convert, std::vector<T>& arr)
+{
+    const auto sizeData = Opm::EclIO::block_size_data_formatted(arrType);
+
+    const long maxBlockSize = std::get<0>(sizeData);
+    const long nColumns = std::get<1>(sizeData);
+    const long columnWidth = std::get<2>(sizeData);
+
+    const long lineSize = nColumns * columnWidth + 1;
+    const long blockSize = maxBlockSize * columnWidth + (maxBlockSize + nColumns - 1) / nColumns;
+    const long chunkSize = 64 * maxBlockSize;
+
+    std::vector<char> buffer(sizeOnDiskFormatted(std::min(static_cast<long>(size), chunkSize), arrType));
+    arr.resize(size);
+
+    for (long chunkStart = 0; chunkStart < size; chunkStart += chunkSize) {
+        const long numInChunk = std::min(chunkSize, size - chunkStart);
+        const long numBytes = sizeOnDiskFormatted(numInChunk, arrType);
+
+        fileH.read(buffer.data(), numBytes);
+        if (fileH.gcount() != numBytes) {
+            return false;
+        }
+
+        for (long blockStart = 0; blockStart < numInChunk; blockStart += maxBlockSize) {
+            const long numInBlock = std::min(maxBlockSize, numInChunk - blockStart);
+            const long offset = (blockStart / maxBlockSize) * blockSize;
+
+            for (long lineStart = 0; lineStart < numInBlock; lineStart += nColumns) {
+                const long numInLine = std::min(nColumns, numInBlock - lineStart);
+                if (buffer[offset + (lineStart / nColumns) * lineSize + numInLine * columnWidth] != '\n') {
+                    return false;
+                }
+            }
+        }
+
+        const char* data = buffer.data();
+        auto field = [data, maxBlockSize, nColumns, columnWidth, lineSize, blockSize](long k)
+                     {
+                         const long j = k % maxBlockSize;
+                         return data + (k / maxBlockSize) * blockSize
+                                     + (j / nColumns) * lineSize
+                                     + (j % nColumns) * columnWidth;
+                     };
+
+        auto token = [columnWidth](const char* first)
+                     {
+                         const char* last = first + columnWidth;
+                         first++;
+
+                         while (first != last && *first == ' ') {
+                             first++;
+                         }
+
+                         return first;
+                     };
+
+        T* values = arr.data() + chunkStart;
+        long failures = 0;
+
+#pragma omp parallel for reduction(+:failures) if (numInChunk > 10000)
+        for (long k = 0; k < numInChunk; k++) {
+            const char* first = field(k);
+            if (*first != ' ' || !parse(token(first), first + columnWidth, values[k])) {
+                failures++;
+            }
+        }
+
+        // Values which are not in the canonical form are converted serially.
+        for (long k = 0; failures > 0 && k < numInChunk; k++) {
+            const char* first = field(k);
+            const char* last = first + columnWidth;
+            const char* tokenFirst = token(first);
+
+            if (*first == ' ' && parse(tokenFirst, last, values[k])) {
+                continue;
+            }
+
+            if (*first != ' ' || tokenFirst == last || std::find_if(tokenFirst, last, isBlank) != last) {
+                return false;
+            }
+
+            values[k] = convert(std::string(tokenFirst, last));
+            failures--;
+        }
+    }
+
+    return true;
+}
+
+
+template<typename T, typename Parse, typename Convert>
 std::vector<T> readFormattedArray(std::fstream& fileH, const int size,
-                                 std::function<T(const std::string&)>& process)
+                                  Opm::EclIO::eclArrType arrType, Parse parse,
+                                  Convert convert)
 {
+    const auto startPos = fileH.tellg();
+
     std::vector<T> arr;
-    std::vector<std::string> tokens;
-    std::string line;
+    if (readFixedWidthArray(fileH, size, arrType, parse, convert, arr)) {
+        return arr;
+    }
 
-    int num = 0;
-    while (num < size) {
-        if (fileH.eof()) {
+    fileH.clear();
+    fileH.seekg(startPos);
+
+    const std::vector<char> buffer = readFormattedBuffer(fileH, size, arrType);
+
+    arr.clear();
+    arr.reserve(size);
+
+    const char* pos = buffer.data();
+    const char* end = pos + buffer.size();
+
+    for (int num = 0; num < size; num++) {
+        while (pos != end && isBlank(*pos)) {
+            pos++;
+        }
+
+        if (pos == end) {
             OPM_THROW(std::runtime_error, "End of file reached when reading array");
         }
 
-        getline(fileH, line);
-        tokens = split_string(line);
+        const char* first = pos;
+        while (pos != end && !isBlank(*pos)) {
+            pos++;
+        }
 
-        for (const std::string& token : tokens) {
-            arr.push_back(process(token));
+        T value;
+        if (!parse(first, pos, value)) {
+            value = convert(std::string(first, pos));
         }
 
-        num = num + tokens.size();
+        arr.push_back(value);
     }
 
     return arr;
 }
 
 
+int convertInte(const std::string& val)
+{
+    return std::stoi(val);
+}
+
+
+float convertReal(const std::string& val)
+{
+    // tskille: temporary fix, need to be discussed. OPM flow writes numbers
+    // that are outside valid range for float, and function stof will fail
+    double dtmpv = std::stod(val);
+    return dtmpv;
+}
+
+
+double convertDoub(const std::string& value)
+{
+    std::string val(value);
+    int p1 = val.find_first_of("D");
+
+    if (p1 == -1) {
+        p1 = val.find_first_of("-", 1);
+        if (p1 > -1) {
+            val = val.insert(p1,"E");
+        } else {
+            p1 = val.find_first_of("+", 1);
+
+            if (p1 == -1) {
+                std::string message="In Routine Read readFormattedDoubArray, could not convert '" + val + "' to double.";
+                OPM_THROW(std::invalid_argument,message);
+            }
+
+            val = val.insert(p1,"E");
+        }
+    } else {
+        val.replace(p1,1,"E");
+    }
+
+    return std::stod(val);
+}
+
+
+bool parseInte(const char* first, const char* last, int& value)
+{
+    const bool negative = (first != last) && (*first == '-');
+    if (first != last && (*first == '-' || *first == '+')) {
+        first++;
+    }
+
+    if (first == last || (last - first) > 10) {
+        return false;
+    }
+
+    long long result = 0;
+    for (const char* p = first; p != last; p++) {
+        if (*p < '0' || *p > '9') {
+            return false;
+        }
+
+        result = 10 * result + (*p - '0');
+    }
+
+    if (negative) {
+        result = -result;
+    }
+
+    if (result < std::numeric_limits<int>::min() || result > std::numeric_limits<int>::max()) {
+        return false;
+    }
+
+    value = static_cast<int>(result);
+    return true;
+}
+
+
+/*
+  Parses the token [-]ddd.ddd[<expChar>(+|-)ddd], where the exponent
+  character can be omitted in front of the sign if bareExponent is true.
+  When the mantissa fits in 53 bits and the decimal exponent is at most 22
+  in magnitude the value is computed with one correctly rounded
+  multiplication or division of exact operands, which is bitwise identical
+  to std::strtod(). All other tokens are rejected.
+*/
+bool parseFloatingPoint(const char* first, const char* last, char expChar,
+                        bool bareExponent, bool requireExponent, double& value)
+{
+    static const double powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const char* p = first;
+    const bool negative = (p != last) && (*p == '-');
+    if (p != last && (*p == '-' || *p == '+')) {
+        p++;
+    }
+
+    std::uint64_t mantissa = 0;
+    int nDigits = 0;
+    int nSignificant = 0;
+    int nFraction = 0;
+    bool fraction = false;
+
+    for (; p != last; p++) {
+        if (*p >= '0' && *p <= '9') {
+            if (mantissa > 0 || *p != '0') {
+                if (++nSignificant > 19) {
+                    return false;
+                }
+            }
+
+            mantissa = 10 * mantissa + (*p - '0');
+            nDigits++;
+
+            if (fraction) {
+                nFraction++;
+            }
+        } else if (*p == '.' && !fraction) {
+            fraction = true;
+        } else {
+            break;
+        }
+    }
+
+    if (nDigits == 0) {
+        return false;
+    }
+
+    int exponent = 0;
+    if (p != last) {
+        if (*p == expChar) {
+            p++;
+        } else if (!bareExponent || (*p != '-' && *p != '+')) {
+            return false;
+        }
+
+        const bool negativeExponent = (p != last) && (*p == '-');
+        if (p != last && (*p == '-' || *p == '+')) {
+            p++;
+        }
+
+        if (p == last || (last - p) > 4) {
+            return false;
+        }
+
+        for (; p != last; p++) {
+            if (*p < '0' || *p > '9') {
+                return false;
+            }
+
+            exponent = 10 * exponent + (*p - '0');
+        }
+
+        if (negativeExponent) {
+            exponent = -exponent;
+        }
+    } else if (requireExponent) {
+        return false;
+    }
+
+    const int scale = exponent - nFraction;
+    if (mantissa > (std::uint64_t(1) << 53) || scale > 22 || scale < -22) {
+        return false;
+    }
+
+    double result = static_cast<double>(mantissa);
+    if (scale >= 0) {
+        result *= powers[scale];
+    } else {
+        result /= powers[-scale];
+    }
+
+    value = negative ? -result : result;
+    return true;
+}
+
+
 std::vector<int> readFormattedInteArray(std::fstream& fileH, const int size)
 {
-    std::function<int(const std::string&)> f = [](const std::string& val)
-                                               {
-                                                   return std::stoi(val);
-                                               };
-    return readFormattedArray(fileH, size, f);
+    return readFormattedArray<int>(fileH, size, Opm::EclIO::INTE, parseInte, convertInte);
 }
 
 
 std::vector<std::string> readFormattedCharArray(std::fstream& fileH, const int size)
 {
-    if (!fileH.is_open()) {
-        OPM_THROW(std::runtime_error, "fstream fileH not open for reading");
-    }
+    const std::vector<char> buffer = readFormattedBuffer(fileH, size, Opm::EclIO::CHAR);
 
     std::vector<std::string> arr;
-    int num = 0;
-    while (num < size) {
-        std::string line;
-        getline(fileH, line);
+    arr.reserve(size);
+
+    const char* pos = buffer.data();
+    const char* end = pos + buffer.size();
 
-        if (line.empty()) {
+    while (static_cast<int>(arr.size()) < size) {
+        while (pos != end && isBlank(*pos)) {
+            pos++;
+        }
+
+        if (pos == end) {
             std::string message="Reading formatted char array, end of file or blank line, read " + std::to_string(arr.size()) + " of " + std::to_string(size) + " elements";
             OPM_THROW(std::runtime_error, message);
         }
 
-        int p1 = line.find_first_of("'");
+        const char* close = (*pos == '\'') ? static_cast<const char*>(std::memchr(pos + 1, '\'', end - pos - 1)) : nullptr;
 
-        if (p1 == -1) {
+        if (close == nullptr) {
             std::string message="Reading formatted char array, all strings must be enclosed by apostrophe (')";
             OPM_THROW(std::runtime_error, message);
         }
 
-        while (p1 > -1) {
-            int p2 = line.find_first_of("'", p1 + 1);
+        const char* first = pos + 1;
+        if (close - first != 8) {
+            std::string message="Reading formatted char array, all strings should have 8 characters";
+            OPM_THROW(std::runtime_error, message);
+        }
 
-            if (p2 == -1) {
-                std::string message="Reading formatted char array, all strings must be enclosed by apostrophe (')";
-                OPM_THROW(std::runtime_error, message);
-            }
+        const char* last = close;
+        while (last != first && *(last - 1) == ' ') {
+            last--;
+        }
 
-            std::string value = line.substr(p1 + 1, p2 - p1 - 1);
+        arr.emplace_back(first, last);
+        pos = close + 1;
+    }
 
-            if (value.size() != 8) {
-                std::string message="Reading formatted char array, all strings should have 8 characters";
-                OPM_THROW(std::runtime_error, message);
-            }
+    return arr;
+}
 
-            if (value == "        ") {
-                arr.push_back("");
-            } else {
-                arr.push_back(Opm::EclIO::trimr(value));
-            }
 
-            num++;
+std::vector<float> readFormattedRealArray(std::fstream &fileH, const int size)
+{
+    auto parse = [](const char* first, const char* last, float& value)
+                 {
+                     double dvalue;
+                     if (parseFloatingPoint(first, last, 'E', false, false, dvalue)) {
+                         value = static_cast<float>(dvalue);
+                         return true;
+                     }
+
+                     return false;
+                 };
+
+    return readFormattedArray<float>(fileH, size, Opm::EclIO::REAL, parse, convertReal);
+}
+
 
-            p1 = line.find_first_of("'", p2 + 1);
+std::vector<bool> readFormattedLogiArray(std::fstream& fileH, const int size)
+{
+    const std::vector<char> buffer = readFormattedBuffer(fileH, size, Opm::EclIO::LOGI);
+
+    std::vector<bool> arr;
+    arr.reserve(size);
+
+    const char* pos = buffer.data();
+    const char* end = pos + buffer.size();
+
+    for (int num = 0; num < size; num++) {
+        while (pos != end && isBlank(*pos)) {
+            pos++;
+        }
+
+        if (pos == end) {
+            OPM_THROW(std::runtime_error, "End of file reached when reading array");
+        }
+
+        const char* first = pos;
+        while (pos != end && !isBlank(*pos)) {
+            pos++;
+        }
+
+        if (pos - first == 1 && *first == 'T') {
+            arr.push_back(true);
+        } else if (pos - first == 1 && *first == 'F') {
+            arr.push_back(false);
+        } else {
+            std::string message="Could not convert '" + std::string(first, pos) + "' to a bool value ";
+            OPM_THROW(std::invalid_argument, message);
         }
     }
 
     return arr;
 }
 
+std::vector<double> readFormattedDoubArray(std::fstream& fileH, const int size)
+{
+    auto parse = [](const char* first, const char* last, double& value)
+                 {
+                     return parseFloatingPoint(first, last, 'D', true, true, value);
+                 };
+
+    return readFormattedArray<double>(fileH, size, Opm::EclIO::DOUB, parse, convertDoub);
+}
+
+/*
+  Conversion of single elements read by EclFile::getElements(). The range
+  [first, last) is one element of a binary file, or one column of a
+  formatted file.
+*/
 
-std::vector<float> readFormattedRealArray(std::fstream &fileH, const int size)
+void trimBlanks(const char*& first, const char*& last)
 {
-    std::function<float(const std::string&)> f = [](const std::string& val)
-                                                 {
-                                                     // tskille: temporary fix, need to be discussed. OPM flow writes numbers
-                                                     // that are outside valid range for float, and function stof will fail
-                                                     double dtmpv = std::stod(val);
-                                                     return dtmpv;
-                                                 };
-    return readFormattedArray<float>(fileH, size, f);
+    while (first != last && isBlank(*first)) {
+        first++;
+    }
+
+    while (last != first && isBlank(*(last - 1))) {
+        last--;
+    }
 }
 
 
-std::vector<bool> readFormattedLogiArray(std::fstream& fileH, const int size)
+int decodeInte(const char* first, const char* last, bool formatted)
 {
-    std::function<bool(const std::string&)> f = [](const std::string& val)
-                                                {
-                                                    if (val == "T") {
-                                                        return true;
-                                                    } else if (val == "F") {
-                                                        return false;
-                                                    } else {
-                                                        std::string message="Could not convert '" + val + "' to a bool value ";
-                                                        OPM_THROW(std::invalid_argument, message);
-                                                    }
-                                                };
-    return readFormattedArray<bool>(fileH, size, f);
+    int value;
+
+    if (!formatted) {
+        std::memcpy(&value, first, sizeof(value));
+        return Opm::EclIO::flipEndianInt(value);
+    }
+
+    trimBlanks(first, last);
+    return parseInte(first, last, value) ? value : convertInte(std::string(first, last));
 }
 
-std::vector<double> readFormattedDoubArray(std::fstream& fileH, const int size)
+
+float decodeReal(const char* first, const char* last, bool formatted)
 {
-    std::function<double(const std::string&)> f = [](const std::string& value)
-                                                  {
-                                                      std::string val(value);
-                                                      int p1 = val.find_first_of("D");
+    if (!formatted) {
+        float value;
+        std::memcpy(&value, first, sizeof(value));
+        return Opm::EclIO::flipEndianFloat(value);
+    }
 
-                                                      if (p1 == -1) {
-                                                          p1 = val.find_first_of("-", 1);
-                                                          if (p1 > -1) {
-                                                              val = val.insert(p1,"E");
-                                                          } else {
-                                                              p1 = val.find_first_of("+", 1);
+    double value;
+    trimBlanks(first, last);
+    if (parseFloatingPoint(first, last, 'E', false, false, value)) {
+        return static_cast<float>(value);
+    }
+
+    return convertReal(std::string(first, last));
+}
 
-                                                              if (p1 == -1) {
-                                                                  std::string message="In Routine Read readFormattedDoubArray, could not convert '" + val + "' to double.";
-                                                                  OPM_THROW(std::invalid_argument,message);
-                                                              }
 
-                                                              val = val.insert(p1,"E");
-                                                          }
-                                                      } else {
-                                                          val.replace(p1,1,"E");
-                                                      }
+double decodeDoub(const char* first, const char* last, bool formatted)
+{
+    double value;
+
+    if (!formatted) {
+        std::memcpy(&value, first, sizeof(value));
+        return Opm::EclIO::flipEndianDouble(value);
+    }
 
-                                                      return std::stod(val);
-                                                  };
-    return readFormattedArray<double>(fileH, size, f);
+    trimBlanks(first, last);
+    return parseFloatingPoint(first, last, 'D', true, true, value) ? value : convertDoub(std::string(first, last));
+}
+
+
+bool decodeLogi(const char* first, const char* last, bool formatted)
+{
+    if (!formatted) {
+        unsigned int intVal;
+        std::memcpy(&intVal, first, sizeof(intVal));
+
+        if (intVal == Opm::EclIO::true_value) {
+            return true;
+        } else if (intVal == Opm::EclIO::false_value) {
+            return false;
+        }
+
+        OPM_THROW(std::runtime_error, "Error reading logi value");
+    }
+
+    trimBlanks(first, last);
+    if (last - first == 1 && *first == 'T') {
+        return true;
+    } else if (last - first == 1 && *first == 'F') {
+        return false;
+    }
+
+    std::string message="Could not convert '" + std::string(first, last) + "' to a bool value ";
+    OPM_THROW(std::invalid_argument, message);
+}
+
+
+std::string decodeChar(const char* first, const char* last, bool formatted)
+{
+    if (formatted) {
+        // The column is " 'ABCDEFGH'"
+        first = static_cast<const char*>(std::memchr(first, '\'', last - first));
+
+        if (first == nullptr || last - first != 10 || *(last - 1) != '\'') {
+            std::string message="Reading formatted char array, all strings must be enclosed by apostrophe (')";
+            OPM_THROW(std::runtime_error, message);
+        }
+
+        first++;
+        last--;
+    }
+
+    return Opm::EclIO::trimr(std::string(first, last));
 }
 
 } // anonymous namespace
@@ -706,6 +1128,50 @@ void EclFile::loadData(int arrIndex)
 }
 
 
+void EclFile::unloadData(const std::string& name)
+{
+    for (size_t i = 0; i < array_name.size(); i++) {
+        if (array_name[i] == name) {
+            unloadData(i);
+        }
+    }
+}
+
+
+void EclFile::unloadData(const std::vector<int>& arrIndex)
+{
+    for (int ind : arrIndex) {
+        unloadData(ind);
+    }
+}
+
+
+void EclFile::unloadData(int arrIndex)
+{
+    switch (array_type[arrIndex]) {
+    case INTE:
+        inte_array.erase(arrIndex);
+        break;
+    case REAL:
+        real_array.erase(arrIndex);
+        break;
+    case DOUB:
+        doub_array.erase(arrIndex);
+        break;
+    case LOGI:
+        logi_array.erase(arrIndex);
+        break;
+    case CHAR:
+        char_array.erase(arrIndex);
+        break;
+    default:
+        break;
+    }
+
+    arrayLoaded[arrIndex] = false;
+}
+
+
 std::vector<EclFile::EclEntry> EclFile::getList() const
 {
     std::vector<EclEntry> list;
@@ -754,6 +1220,152 @@ const std::vector<std::string>& EclFile::get<std::string>(int arrIndex)
 }
 
 
+/*
+  The elements are sorted, and for each Fortran record (binary files) or
+  block (formatted files) of the array which holds any of the requested
+  elements, only the part of the record between the first and the last
+  requested element is read.
+*/
+template<class T, class Decode>
+std::vector<T> EclFile::getElementsImpl(int arrIndex, eclArrType type,
+                                        const std::unordered_map<int, std::vector<T>>& array,
+                                        const std::string& typeStr,
+                                        const std::vector<int>& elements, Decode decode)
+{
+    if (array_type[arrIndex] != type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + typeStr;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    for (int element : elements) {
+        if (element < 0 || element >= array_size[arrIndex]) {
+            std::string message = "Element " + std::to_string(element) + " out of range for array " + array_name[arrIndex];
+            OPM_THROW(std::invalid_argument, message);
+        }
+    }
+
+    std::vector<T> values(elements.size());
+
+    if (arrayLoaded[arrIndex]) {
+        const auto& data = array.at(arrIndex);
+        for (size_t i = 0; i < elements.size(); i++) {
+            values[i] = data[elements[i]];
+        }
+
+        return values;
+    }
+
+    long elementsPerBlock, blockSize, width, nColumns = 1, lineSize = 0;
+
+    if (formatted) {
+        auto sizeData = block_size_data_formatted(type);
+        elementsPerBlock = std::get<0>(sizeData);
+        nColumns = std::get<1>(sizeData);
+        width = std::get<2>(sizeData);
+
+        lineSize = nColumns * width + 1;
+        blockSize = elementsPerBlock * width + (elementsPerBlock + nColumns - 1) / nColumns;
+    } else {
+        auto sizeData = block_size_data_binary(type);
+        width = std::get<0>(sizeData);
+        elementsPerBlock = std::get<1>(sizeData) / width;
+
+        // Leading and trailing record size markers
+        blockSize = std::get<1>(sizeData) + 8;
+    }
+
+    auto offsetInBlock = [this, width, nColumns, lineSize](long j)
+                         {
+                             return formatted ? (j / nColumns) * lineSize + (j % nColumns) * width : 4 + j * width;
+                         };
+
+    std::vector<size_t> order(elements.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&elements](size_t a, size_t b) { return elements[a] < elements[b]; });
+
+    std::fstream fileH;
+
+    if (formatted) {
+        fileH.open(inputFilename, std::ios::in);
+    } else {
+        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+    }
+
+    if (!fileH) {
+        std::string message="Could not open file: '" + inputFilename +"'";
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    std::vector<char> buffer;
+
+    size_t first = 0;
+    while (first < order.size()) {
+        const long block = elements[order[first]] / elementsPerBlock;
+
+        size_t last = first + 1;
+        while (last < order.size() && elements[order[last]] / elementsPerBlock == block) {
+            last++;
+        }
+
+        const long start = offsetInBlock(elements[order[first]] % elementsPerBlock);
+        const long end = offsetInBlock(elements[order[last - 1]] % elementsPerBlock) + width;
+
+        buffer.resize(end - start);
+        fileH.seekg(ifStreamPos[arrIndex] + block * blockSize + start);
+        fileH.read(buffer.data(), buffer.size());
+
+        if (!fileH) {
+            std::string message = "Error reading elements of array " + array_name[arrIndex] + " from file: '" + inputFilename + "'";
+            OPM_THROW(std::runtime_error, message);
+        }
+
+        for (size_t i = first; i < last; i++) {
+            const char* data = buffer.data() + offsetInBlock(elements[order[i]] % elementsPerBlock) - start;
+            values[order[i]] = decode(data, data + width, formatted);
+        }
+
+        first = last;
+    }
+
+    return values;
+}
+
+
+template<>
+std::vector<int> EclFile::getElements<int>(int arrIndex, const std::vector<int>& elements)
+{
+    return getElementsImpl(arrIndex, INTE, inte_array, "integer", elements, decodeInte);
+}
+
+
+template<>
+std::vector<float> EclFile::getElements<float>(int arrIndex, const std::vector<int>& elements)
+{
+    return getElementsImpl(arrIndex, REAL, real_array, "float", elements, decodeReal);
+}
+
+
+template<>
+std::vector<double> EclFile::getElements<double>(int arrIndex, const std::vector<int>& elements)
+{
+    return getElementsImpl(arrIndex, DOUB, doub_array, "double", elements, decodeDoub);
+}
+
+
+template<>
+std::vector<bool> EclFile::getElements<bool>(int arrIndex, const std::vector<int>& elements)
+{
+    return getElementsImpl(arrIndex, LOGI, logi_array, "bool", elements, decodeLogi);
+}
+
+
+template<>
+std::vector<std::string> EclFile::getElements<std::string>(int arrIndex, const std::vector<int>& elements)
+{
+    return getElementsImpl(arrIndex, CHAR, char_array, "string", elements, decodeChar);
+}
+
+
 bool EclFile::hasKey(const std::string &name) const
 {
     auto search = array_index.find(name);
@@ -25,6 +25,7 @@
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
@@ -32,6 +33,132 @@
 #include <sstream>
 #include <stdexcept>
 #include <typeinfo>
+#include <vector>
+
+namespace {
+
+/*
+  Hand written formatting of the values in formatted files. The digits of
+  the REAL and DOUB values are generated by std::snprintf(), which is
+  correctly rounded, and then rearranged to the Eclipse layout with a
+  leading '0.' and the exponent increased by one, i.e. 123.45 is written
+  as 0.12345000E+03. The functions write to a buffer which must hold at
+  least 32 characters, and return the number of characters written.
+*/
+
+int formatExponent(int exp, char* buffer)
+{
+    // Equivalent to "%+03i"
+    int n = 0;
+    buffer[n++] = exp < 0 ? '-' : '+';
+
+    unsigned int value = exp < 0 ? -exp : exp;
+    char digits[8];
+    int nDigits = 0;
+    do {
+        digits[nDigits++] = '0' + value % 10;
+        value /= 10;
+    } while (value > 0);
+
+    if (nDigits < 2) {
+        digits[nDigits++] = '0';
+    }
+
+    while (nDigits > 0) {
+        buffer[n++] = digits[--nDigits];
+    }
+
+    return n;
+}
+
+
+int formatInte(int value, char* buffer)
+{
+    char digits[16];
+    int nDigits = 0;
+
+    unsigned int absValue = value < 0 ? 0u - static_cast<unsigned int>(value) : value;
+    do {
+        digits[nDigits++] = '0' + absValue % 10;
+        absValue /= 10;
+    } while (absValue > 0);
+
+    int n = 0;
+    if (value < 0) {
+        buffer[n++] = '-';
+    }
+
+    while (nDigits > 0) {
+        buffer[n++] = digits[--nDigits];
+    }
+
+    return n;
+}
+
+
+/*
+  The number of decimals printed by snprintf() is numDecimals, and the
+  exponent character, 'E' or 'D', is omitted when the magnitude of the
+  exponent is 100 or more if dropExpChar is true.
+*/
+int formatFloatingPoint(double value, int numDecimals, char expChar, bool dropExpChar, char* buffer)
+{
+    if (!std::isfinite(value)) {
+        OPM_THROW(std::invalid_argument, "Can not write non-finite value to formatted file");
+    }
+
+    int n = 0;
+    if (value == 0.0) {
+        buffer[n++] = '0';
+        buffer[n++] = '.';
+        for (int i = 0; i < numDecimals + 1; i++) {
+            buffer[n++] = '0';
+        }
+        buffer[n++] = expChar;
+        buffer[n++] = '+';
+        buffer[n++] = '0';
+        buffer[n++] = '0';
+        return n;
+    }
+
+    char tmp[32];
+    std::snprintf(tmp, sizeof tmp, "%.*E", numDecimals, value);
+
+    const char* p = tmp;
+    if (*p == '-') {
+        buffer[n++] = '-';
+        p++;
+    }
+
+    buffer[n++] = '0';
+    buffer[n++] = '.';
+    buffer[n++] = p[0];
+    for (int i = 0; i < numDecimals; i++) {
+        buffer[n++] = p[2 + i];
+    }
+
+    const int exp = std::atoi(p + 3 + numDecimals);
+    if (!dropExpChar || std::abs(exp) < 100) {
+        buffer[n++] = expChar;
+    }
+
+    return n + formatExponent(exp + 1, buffer + n);
+}
+
+
+int formatReal(float value, char* buffer)
+{
+    return formatFloatingPoint(value, 7, 'E', false, buffer);
+}
+
+
+int formatDoub(double value, char* buffer)
+{
+    return formatFloatingPoint(value, 13, 'D', true, buffer);
+}
+
+} // Anonymous namespace
+
 
 namespace Opm { namespace EclIO {
 
@@ -54,6 +181,7 @@ void EclOutput::write<std::string>(const std::string& name,
     {
         writeFormattedHeader(name, data.size(), CHAR);
         writeFormattedCharArray(data);
+        ofileH.flush();
     }
     else
     {
@@ -70,6 +198,7 @@ void EclOutput::write<PaddedOutputString<8>>
     if (this->isFormatted) {
         writeFormattedHeader(name, data.size(), CHAR);
         writeFormattedCharArray(data);
+        ofileH.flush();
     }
     else {
         writeBinaryHeader(name, data.size(), CHAR);
@@ -158,6 +287,8 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
         OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
     }
 
+    std::vector<char> buffer(std::min(size * sizeOfElement, maxBlockSize));
+
     rest = size * sizeOfElement;
     while (rest > 0) {
         if (rest > maxBlockSize) {
@@ -170,30 +301,33 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
         dhead = flipEndianInt(num * sizeOfElement);
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-
+        // The block is assembled in the buffer and written in one operation.
+        char* pos = buffer.data();
         for (int i = 0; i < num; i++) {
             if (arrType == INTE) {
                 rval = flipEndianInt(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&rval), sizeof(rval));
+                std::memcpy(pos, &rval, sizeof(rval));
             } else if (arrType == REAL) {
                 value_f = flipEndianFloat(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&value_f), sizeof(value_f));
+                std::memcpy(pos, &value_f, sizeof(value_f));
             } else if (arrType == DOUB) {
                 value_d = flipEndianDouble(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&value_d), sizeof(value_d));
+                std::memcpy(pos, &value_d, sizeof(value_d));
             } else if (arrType == LOGI) {
                 intVal = data[n] ? true_value : false_value;
-                ofileH.write(reinterpret_cast<char*>(&intVal), sizeOfElement);
+                std::memcpy(pos, &intVal, sizeOfElement);
             } else {
                 std::cerr << "type not supported in write binaryarray\n";
                 std::exit(EXIT_FAILURE);
             }
 
+            pos += sizeOfElement;
             n++;
         }
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        ofileH.write(buffer.data(), num * sizeOfElement);
+        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
 }
 
@@ -224,6 +358,9 @@ void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data)
         OPM_THROW(std::runtime_error,"fstream fileH not open for writing");
     }
 
+    std::string buffer;
+    buffer.reserve(std::min(rest, maxBlockSize));
+
     while (rest > 0) {
         if (rest > maxBlockSize) {
             rest -= maxBlockSize;
@@ -235,15 +372,16 @@ void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data)
 
         dhead = flipEndianInt(num * sizeOfElement);
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-
+        buffer.clear();
         for (int i = 0; i < num; i++) {
-            std::string tmpStr = data[n] + std::string(8 - data[n].size(),' ');
-            ofileH.write(tmpStr.c_str(), sizeOfElement);
+            buffer.append(data[n]);
+            buffer.append(8 - data[n].size(), ' ');
             n++;
         }
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        ofileH.write(buffer.data(), buffer.size());
+        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
 }
 
@@ -291,88 +429,27 @@ void EclOutput::writeFormattedHeader(const std::string& arrName, int size, eclAr
 
     switch (arrType) {
     case INTE:
-        ofileH << " 'INTE'" <<  std::endl;
+        ofileH << " 'INTE'" << '\n';
         break;
     case REAL:
-        ofileH << " 'REAL'" <<  std::endl;
+        ofileH << " 'REAL'" << '\n';
         break;
     case DOUB:
-        ofileH << " 'DOUB'" <<  std::endl;
+        ofileH << " 'DOUB'" << '\n';
         break;
     case LOGI:
-        ofileH << " 'LOGI'" <<  std::endl;
+        ofileH << " 'LOGI'" << '\n';
         break;
     case CHAR:
-        ofileH << " 'CHAR'" <<  std::endl;
+        ofileH << " 'CHAR'" << '\n';
         break;
     case MESS:
-        ofileH << " 'MESS'" <<  std::endl;
+        ofileH << " 'MESS'" << '\n';
         break;
     }
 }
 
 
-std::string EclOutput::make_real_string(float value) const
-{
-    char buffer [15];
-    std::sprintf (buffer, "%10.7E", value);
-
-    if (value == 0.0) {
-        return "0.00000000E+00";
-    } else {
-        std::string tmpstr(buffer);
-
-        int exp =  value < 0.0 ? std::stoi(tmpstr.substr(11, 3)) :  std::stoi(tmpstr.substr(10, 3));
-
-        if (value < 0.0) {
-            tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 7) + "E";
-        } else {
-            tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 7) +"E";
-        }
-
-        std::sprintf (buffer, "%+03i", exp+1);
-        tmpstr = tmpstr+buffer;
-
-        return tmpstr;
-    }
-}
-
-
-std::string EclOutput::make_doub_string(double value) const
-{
-    char buffer [21];
-    std::sprintf (buffer, "%19.13E", value);
-
-    if (value == 0.0) {
-        return "0.00000000000000D+00";
-    } else {
-        std::string tmpstr(buffer);
-
-        int exp =  value < 0.0 ? std::stoi(tmpstr.substr(17, 4)) :  std::stoi(tmpstr.substr(16, 4));
-
-        if (value < 0.0) {
-            if (std::abs(exp) < 100) {
-                tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 13) + "D";
-            } else {
-                tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 13);
-            }
-        }
-        else {
-            if (std::abs(exp) < 100) {
-                tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 13) + "D";
-            } else {
-                tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 13);
-            }
-        }
-
-        std::sprintf (buffer, "%+03i", exp+1);
-        tmpstr = tmpstr + buffer;
-
-        return tmpstr;
-    }
-}
-
-
 template <typename T>
 void EclOutput::writeFormattedArray(const std::vector<T>& data)
 {
@@ -396,42 +473,55 @@ void EclOutput::writeFormattedArray(const std::vector<T>& data)
     int nColumns = std::get<1>(sizeData);
     int columnWidth = std::get<2>(sizeData);
 
+    // One block is assembled in the buffer and written in one operation.
+    std::string buffer;
+    buffer.reserve((columnWidth + 1) * std::min(size, maxBlockSize) + 1);
+
+    char value[32];
     for (int i = 0; i < size; i++) {
         n++;
 
+        int length = 0;
         switch (arrType) {
         case INTE:
-            ofileH << std::setw(columnWidth) << data[i];
+            length = formatInte(data[i], value);
             break;
         case REAL:
-            ofileH << std::setw(columnWidth) << make_real_string(data[i]);
+            length = formatReal(data[i], value);
             break;
         case DOUB:
-            ofileH << std::setw(columnWidth) << make_doub_string(data[i]);
+            length = formatDoub(data[i], value);
             break;
         case LOGI:
-            if (data[i]) {
-                ofileH << "  T";
-            } else {
-                ofileH << "  F";
-            }
+            buffer.append(data[i] ? "  T" : "  F");
             break;
         default:
             break;
         }
 
+        if (length > 0) {
+            if (length < columnWidth) {
+                buffer.append(columnWidth - length, ' ');
+            }
+            buffer.append(value, length);
+        }
+
         if ((n % nColumns) == 0 || (n % maxBlockSize) == 0) {
-            ofileH << std::endl;
+            buffer.push_back('\n');
         }
 
         if ((n % maxBlockSize) == 0) {
             n=0;
+            ofileH.write(buffer.data(), buffer.size());
+            buffer.clear();
         }
     }
 
     if ((n % nColumns) != 0 && (n % maxBlockSize) != 0) {
-        ofileH << std::endl;
+        buffer.push_back('\n');
     }
+
+    ofileH.write(buffer.data(), buffer.size());
 }
 
 
@@ -450,20 +540,25 @@ void EclOutput::writeFormattedCharArray(const std::vector<std::string>& data)
 
     int size = data.size();
 
-    for (int i = 0; i < size; i++) {
-        std::string str1(8,' ');
-        str1 = data[i] + std::string(8 - data[i].size(),' ');
+    std::string buffer;
+    buffer.reserve(12 * size + size / nColumns + 1);
 
-        ofileH << " '" << str1 << "'";
+    for (int i = 0; i < size; i++) {
+        buffer.append(" '");
+        buffer.append(data[i]);
+        buffer.append(8 - data[i].size(), ' ');
+        buffer.push_back('\'');
 
         if ((i+1) % nColumns == 0) {
-            ofileH  << std::endl;
+            buffer.push_back('\n');
         }
     }
 
     if ((size % nColumns) != 0) {
-        ofileH  << std::endl;
+        buffer.push_back('\n');
     }
+
+    ofileH.write(buffer.data(), buffer.size());
 }
 
 void EclOutput::writeFormattedCharArray(const std::vector<PaddedOutputString<8>>& data)
@@ -53,8 +53,10 @@ void data::Solution::convertToSI( const UnitSystem& units ) {
 
     for( auto& elm : *this ) {
         UnitSystem::measure dim = elm.second.dim;
-        if (dim != UnitSystem::measure::identity)
-            units.to_si( dim , elm.second.data );
+        if (dim != UnitSystem::measure::identity) {
+            auto& data = elm.second.data;
+            units.to_si_conversion( dim )( data.data(), data.data(), data.size() );
+        }
     }
 
     this->si = true;
@@ -65,8 +67,10 @@ void data::Solution::convertFromSI( const UnitSystem& units ) {
 
     for (auto& elm : *this ) {
         UnitSystem::measure dim = elm.second.dim;
-        if (dim != UnitSystem::measure::identity)
-            units.from_si( dim , elm.second.data );
+        if (dim != UnitSystem::measure::identity) {
+            auto& data = elm.second.data;
+            units.from_si_conversion( dim )( data.data(), data.data(), data.size() );
+        }
     }
 
     this->si = false;
@@ -61,6 +61,7 @@
 #include <ert/ecl/ecl_rft_file.h>
 #include <ert/ecl/ecl_rst_file.h>
 #include <ert/ecl_well/well_const.h>
+#include <ert/util/ert_unique_ptr.hpp>
 #include <ert/ecl/ecl_rsthead.h>
 #include <ert/util/util.h>
 #include <ert/ecl/fortio.h>
@@ -24,6 +24,7 @@
 #include <cmath>
 #include <cassert>
 #include <utility>
+#include <vector>
 
 Opm::LinearisedOutputTable::
 LinearisedOutputTable(const std::size_t numTables0,
@@ -87,48 +88,28 @@ Opm::DifferentiateOutputTable::calcSlopes(const std::size_t      nDep,
         return;
     }
 
-    auto x = table.column(desc.tableID, desc.primID, 0);
+    // Compute the interval widths once, then the slopes one dependent
+    // column at a time from the raw column data.  The inner loop has no
+    // dependencies between iterations.
+    const auto n = desc.numActRows - 1;
 
-    using colIT = decltype(x);
+    const double* x = &*table.column(desc.tableID, desc.primID, 0);
 
-    auto y  = std::vector<colIT>{};  y .reserve(nDep);
-    auto dy = std::vector<colIT>{};  dy.reserve(nDep);
-    auto y0 = std::vector<double>(nDep);
-    auto y1 = y0;
-    for (auto j = 0*nDep; j < nDep; ++j) {
-        y .push_back(table.column(desc.tableID, desc.primID, j + 1 + 0*nDep));
-        dy.push_back(table.column(desc.tableID, desc.primID, j + 1 + 1*nDep));
-
-        y1[j] = *y.back();  ++y.back();
-
-        // Store derivatives at right interval end-point.
-        ++dy.back();
+    auto dx = std::vector<double>(n);
+    for (auto i = 0*n; i < n; ++i) {
+        dx[i] = x[i + 1] - x[i];
     }
 
-    using std::swap;
-
-    auto x1 = *x;  ++x;  auto x0 = 0 * x1;
-
-    // Recall: Number of slope intervals one less than number of active
-    // table rows.
-    for (auto n = desc.numActRows - 1, i = 0*n; i < n; ++i) {
-        // Save previous right-hand point as this left-hand point, clear
-        // space for new right-hand point.
-        swap(x0, x1);  x1 = *x;  ++x;
-        swap(y0, y1);
-
-        const auto dx = x1 - x0;
-
-        for (auto j = 0*nDep; j < nDep; ++j) {
-            y1[j] = *y[j];
+    for (auto j = 0*nDep; j < nDep; ++j) {
+        const double* y  = &*table.column(desc.tableID, desc.primID, j + 1 + 0*nDep);
+        double*       dy = &*table.column(desc.tableID, desc.primID, j + 1 + 1*nDep);
 
-            const auto delta = y1[j] - y0[j];
+        // Store derivatives at right interval end-point.
+        for (auto i = 0*n; i < n; ++i) {
+            const auto delta = y[i + 1] - y[i];
 
             // Choice for dx==0 somewhat debatable.
-            *dy[j] = (std::abs(dx) > 0.0) ? (delta / dx) : 0.0;
-
-            // Advance column iterators;
-            ++y[j];  ++dy[j];
+            dy[i + 1] = (std::abs(dx[i]) > 0.0) ? (delta / dx[i]) : 0.0;
         }
     }
 }
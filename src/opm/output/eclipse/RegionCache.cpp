@@ -17,7 +17,11 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <stdexcept>
+
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Events.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/Connection.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/WellConnections.hpp>
@@ -30,31 +34,179 @@
 namespace Opm {
 namespace out {
 
-RegionCache::RegionCache(const Eclipse3DProperties& properties, const EclipseGrid& grid, const Schedule& schedule) {
+namespace {
+
+const long min_parallel_size = 100;
+
+/* The position of the rates of a phase in the six rates of a region. */
+std::size_t rate_offset(data::Rates::opt phase, bool injection) {
+    const std::size_t inj = injection ? 1 : 0;
+    switch (phase) {
+    case data::Rates::opt::wat: return 0 + inj;
+    case data::Rates::opt::oil: return 2 + inj;
+    case data::Rates::opt::gas: return 4 + inj;
+    default:
+        throw std::invalid_argument("Region rates are only available for water, oil and gas");
+    }
+}
+
+}
+
+
+RegionCache::RegionCache(const Eclipse3DProperties& properties, const EclipseGrid& grid, const Schedule& ) :
+    nx( grid.getNX() ),
+    ny( grid.getNY() )
+{
     const auto& fipnum = properties.getIntGridProperty("FIPNUM");
 
-    const auto& wells = schedule.getWells2atEnd();
-    for (const auto& well : wells) {
-        const auto& connections = well.getConnections( );
-        for (const auto& c : connections) {
-            size_t global_index = grid.getGlobalIndex( c.getI() , c.getJ() , c.getK());
-            if (grid.cellActive( global_index )) {
-                size_t active_index = grid.activeIndex( global_index );
-                int region_id =fipnum.iget( global_index );
-                auto& well_index_list = this->connection_map[ region_id ];
-                well_index_list.push_back( { well.name() , active_index } );
+    this->cell_region = fipnum.getData();
+    this->cell_active_index.assign( grid.getCartesianSize(), -1 );
+    for (size_t global_index = 0; global_index < grid.getCartesianSize(); global_index++)
+        if (grid.cellActive( global_index ))
+            this->cell_active_index[ global_index ] = grid.activeIndex( global_index );
+}
+
+
+    bool RegionCache::update(const Schedule& schedule, std::size_t report_step) {
+        if (this->has_layout && report_step == this->layout_step)
+            return false;
+
+        if (this->has_layout && report_step > this->layout_step) {
+            const auto& events = schedule.getEvents();
+            const uint64_t mask = ScheduleEvents::NEW_WELL | ScheduleEvents::COMPLETION_CHANGE;
+            bool changed = false;
+            for (std::size_t step = this->layout_step + 1; step <= report_step && !changed; step++)
+                changed = events.hasEvent( mask, step );
+
+            if (!changed) {
+                this->layout_step = report_step;
+                return false;
+            }
+        }
+
+        /* Count the connections of each region, then fill them in region order. */
+        const auto wells = schedule.getWells2( report_step );
+        std::vector<Connection> connections;
+        std::vector<int> regions;
+        int max_region = -1;
+
+        this->well_names.clear();
+        for (const auto& well : wells) {
+            const std::size_t well_handle = this->well_names.size();
+            this->well_names.push_back( well.name() );
+
+            const auto& well_connections = well.getConnections( );
+            for (std::size_t c = 0; c < well_connections.size(); c++) {
+                const auto& conn = well_connections[c];
+                const std::size_t global_index = conn.getI() + this->nx * (conn.getJ() + this->ny * conn.getK());
+                const int active_index = this->cell_active_index[ global_index ];
+                const int region_id = this->cell_region[ global_index ];
+                if (active_index < 0 || region_id < 0)
+                    continue;
+
+                connections.push_back( { well_handle, c, static_cast<std::size_t>(active_index) } );
+                regions.push_back( region_id );
+                max_region = std::max( max_region, region_id );
             }
         }
+
+        this->region_offset.assign( max_region + 2, 0 );
+        for (const auto region_id : regions)
+            this->region_offset[ region_id + 1 ]++;
+
+        for (std::size_t r = 1; r < this->region_offset.size(); r++)
+            this->region_offset[r] += this->region_offset[r - 1];
+
+        this->region_connections.resize( connections.size() );
+        std::vector<std::size_t> next( this->region_offset.begin(), this->region_offset.end() - 1 );
+        for (std::size_t i = 0; i < connections.size(); i++)
+            this->region_connections[ next[ regions[i] ]++ ] = connections[i];
+
+        this->region_rates.assign( 6 * (this->region_offset.size() - 1), 0.0 );
+        this->has_layout = true;
+        this->layout_step = report_step;
+        return true;
     }
-}
 
 
-    const std::vector<std::pair<std::string,size_t>>& RegionCache::connections( int region_id ) const {
-        const auto iter = this->connection_map.find( region_id );
-        if (iter == this->connection_map.end())
-            return this->connections_empty;
-        else
-            return iter->second;
+    const std::vector<std::string>& RegionCache::wells() const {
+        return this->well_names;
+    }
+
+
+    std::pair<std::size_t, std::size_t> RegionCache::region_range( int region_id ) const {
+        if (region_id < 0 || static_cast<std::size_t>(region_id) + 1 >= this->region_offset.size())
+            return { 0, 0 };
+
+        return { this->region_offset[ region_id ], this->region_offset[ region_id + 1 ] };
+    }
+
+
+    const RegionCache::Connection& RegionCache::connection( std::size_t index ) const {
+        return this->region_connections[ index ];
+    }
+
+
+    void RegionCache::update_rates(const data::Wells& wells, const std::vector<double>& efficiency_factors) {
+        if (efficiency_factors.size() != this->well_names.size())
+            throw std::invalid_argument("There must be one efficiency factor for each well");
+
+        /* Look up the simulator results of each well once. */
+        std::vector<const data::Well*> well_results( this->well_names.size(), nullptr );
+        for (std::size_t w = 0; w < this->well_names.size(); w++) {
+            const auto iter = wells.find( this->well_names[w] );
+            if (iter != wells.end())
+                well_results[w] = &iter->second;
+        }
+
+        const long num_regions = static_cast<long>(this->region_offset.size()) - 1;
+
+#pragma omp parallel for if (num_regions > min_parallel_size)
+        for (long region_id = 0; region_id < num_regions; region_id++) {
+            double rates[6] = { 0, 0, 0, 0, 0, 0 };
+
+            for (std::size_t i = this->region_offset[region_id]; i < this->region_offset[region_id + 1]; i++) {
+                const auto& conn = this->region_connections[i];
+                const auto* well = well_results[ conn.well ];
+                if (!well)
+                    continue;
+
+                /*
+                  The connections of the simulator results are normally in
+                  the same order as in the schedule, otherwise search.
+                */
+                const data::Connection* result = nullptr;
+                if (conn.connection < well->connections.size() && well->connections[conn.connection].index == conn.active_index)
+                    result = &well->connections[conn.connection];
+                else {
+                    const auto iter = std::find_if( well->connections.begin(), well->connections.end(),
+                                                    [&conn]( const data::Connection& c ) { return c.index == conn.active_index; });
+                    if (iter == well->connections.end())
+                        continue;
+                    result = &(*iter);
+                }
+
+                const double efac = efficiency_factors[ conn.well ];
+                const double wat = result->rates.get( data::Rates::opt::wat, 0.0 ) * efac;
+                const double oil = result->rates.get( data::Rates::opt::oil, 0.0 ) * efac;
+                const double gas = result->rates.get( data::Rates::opt::gas, 0.0 ) * efac;
+
+                rates[ wat > 0 ? 1 : 0 ] += wat;
+                rates[ oil > 0 ? 3 : 2 ] += oil;
+                rates[ gas > 0 ? 5 : 4 ] += gas;
+            }
+
+            std::copy( rates, rates + 6, this->region_rates.begin() + 6 * region_id );
+        }
+    }
+
+
+    double RegionCache::rate( int region_id, data::Rates::opt phase, bool injection ) const {
+        const auto offset = rate_offset( phase, injection );
+        if (region_id < 0 || 6 * static_cast<std::size_t>(region_id) >= this->region_rates.size())
+            return 0;
+
+        return this->region_rates[ 6 * region_id + offset ];
     }
 
 }
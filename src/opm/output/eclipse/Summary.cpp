@@ -630,24 +630,14 @@ inline quantity duration( const fn_args& args ) {
     return { args.duration, measure::time };
 }
 
+/*
+  The region rates are summed over the connections of each region by
+  RegionCache::update_rates() once per timestep; production and injection
+  are separated connection by connection.
+*/
 template<rt phase , bool injection>
 quantity region_rate( const fn_args& args ) {
-    double sum = 0;
-    const auto& well_connections = args.regionCache.connections( args.num );
-
-    for (const auto& pair : well_connections) {
-
-        double eff_fac = efac( args.eff_factors, pair.first );
-
-        double rate = args.wells.get( pair.first , pair.second , phase ) * eff_fac;
-
-        // We are asking for the production rate in an injector - or
-        // opposite. We just clamp to zero.
-        if ((rate > 0) != injection)
-            rate = 0;
-
-        sum += rate;
-    }
+    const double sum = args.regionCache.rate( args.num, phase, injection );
 
     if( injection )
         return { sum, rate_unit< phase >() };
@@ -1109,17 +1099,14 @@ inline std::vector<Well2> find_wells( const Schedule& schedule,
         std::vector<Well2> wells;
 
         const auto region = smspec_node_get_num( node );
-
-        for ( const auto& connection : regionCache.connections( region ) ){
-            const auto& w_name = connection.first;
-            if (schedule.hasWell(w_name, sim_step)) {
-                const auto& well = schedule.getWell2( w_name, sim_step );
-
-                const auto& it = std::find_if( wells.begin(), wells.end(),
-                                               [&] ( const Well2& elem )
-                                               { return elem.name() == well.name(); });
-                if ( it == wells.end() )
-                    wells.push_back( schedule.getWell2( w_name, sim_step ));
+        const auto range = regionCache.region_range( region );
+        std::vector<bool> found( regionCache.wells().size(), false );
+
+        for (auto index = range.first; index < range.second; index++) {
+            const auto well_handle = regionCache.connection( index ).well;
+            if (!found[ well_handle ]) {
+                found[ well_handle ] = true;
+                wells.push_back( schedule.getWell2( regionCache.wells()[ well_handle ], sim_step ));
             }
         }
 
@@ -1210,7 +1197,16 @@ class Summary::keyword_handlers {
         std::vector< std::pair< const ecl::smspec_node*, fn > > handlers;
         std::map< std::string, const ecl::smspec_node* > single_value_nodes;
         std::map< std::pair <std::string, int>, const ecl::smspec_node* > region_nodes;
-        std::map< std::pair <std::string, int>, const ecl::smspec_node* > block_nodes;
+
+        /*
+          The block vectors in request order, with the output node and the
+          measure of each request. The position of each (keyword, num) pair
+          is only needed by the map based interface.
+        */
+        std::vector< Summary::BlockRequest > block_requests;
+        std::vector< const ecl::smspec_node* > block_nodes;
+        std::vector< UnitSystem::measure > block_measures;
+        std::map< std::pair <std::string, int>, std::size_t > block_index;
 
         // Memory management for restart-related summary vectors
         // that are not requested in SUMMARY section.
@@ -1308,7 +1304,14 @@ Summary::Summary( const EclipseState& st,
                 continue;
 
             auto* nodeptr = ecl_smspec_add_node( smspec, keyword.c_str(), node.num(), st.getUnits().name( block_pair->second ), 0 );
-            this->handlers->block_nodes.emplace( std::make_pair(keyword, node.num()), nodeptr );
+            const auto position = this->handlers->block_nodes.size();
+            if (this->handlers->block_index.emplace( std::make_pair(keyword, node.num()), position ).second) {
+                this->handlers->block_requests.push_back( { keyword,
+                                                            static_cast<std::size_t>(global_index),
+                                                            this->grid.activeIndex(global_index) } );
+                this->handlers->block_nodes.push_back( nodeptr );
+                this->handlers->block_measures.push_back( block_pair->second );
+            }
         } else if (funs_pair != funs.end()) {
             auto node_type = node.type();
 
@@ -1424,6 +1427,28 @@ Summary::Summary( const EclipseState& st,
  * rates and accumulated values.
  *
  */
+double well_efficiency_factor( const Well2& well,
+                               const Schedule& schedule,
+                               const GroupTree& groupTree,
+                               const char* rate_group,
+                               const int sim_step ) {
+    double eff_factor = well.getEfficiencyFactor();
+    const auto* group_node = &schedule.getGroup(well.groupName());
+
+    while(true){
+        if( rate_group && group_node->name() == rate_group )
+            break;
+        eff_factor *= group_node->getGroupEfficiencyFactor( sim_step );
+
+        const auto& parent = groupTree.parent( group_node->name() );
+        if( !schedule.hasGroup( parent ) )
+            break;
+        group_node = &schedule.getGroup( parent );
+    }
+
+    return eff_factor;
+}
+
 std::vector< std::pair< std::string, double > >
 well_efficiency_factors( const ecl::smspec_node* node,
                          const Schedule& schedule,
@@ -1442,41 +1467,46 @@ well_efficiency_factors( const ecl::smspec_node* node,
     const bool is_group = (var_type == ECL_SMSPEC_GROUP_VAR);
     const bool is_rate = !node->is_total();
     const auto &groupTree = schedule.getGroupTree(sim_step);
+    const char* rate_group = (is_group && is_rate) ? node->get_wgname() : nullptr;
 
     for( const auto& well : schedule_wells ) {
         if (!well.hasBeenDefined(sim_step))
             continue;
 
-        double eff_factor = well.getEfficiencyFactor();
-        const auto* group_node = &schedule.getGroup(well.groupName());
+        efac.emplace_back( well.name(), well_efficiency_factor( well, schedule, groupTree, rate_group, sim_step ) );
+    }
 
-        while(true){
-            if((   is_group
-                && is_rate
-                && group_node->name() == node->get_wgname() ))
-                break;
-            eff_factor *= group_node->getGroupEfficiencyFactor( sim_step );
+    return efac;
+}
 
-            const auto& parent = groupTree.parent( group_node->name() );
-            if( !schedule.hasGroup( parent ) )
-                break;
-            group_node = &schedule.getGroup( parent );
-        }
-        efac.emplace_back( well.name(), eff_factor );
+/*
+ * The efficiency factors of the wells of the region cache, indexed by
+ * well handle; for regions both rates and accumulated values include the
+ * well and group efficiency factors.
+ */
+std::vector< double > region_efficiency_factors( const out::RegionCache& regionCache,
+                                                 const Schedule& schedule,
+                                                 const int sim_step ) {
+    const auto& groupTree = schedule.getGroupTree(sim_step);
+    std::vector< double > efac( regionCache.wells().size(), 1.0 );
+
+    for( std::size_t w = 0; w < efac.size(); w++ ) {
+        const auto& well = schedule.getWell2( regionCache.wells()[w], sim_step );
+        if (well.hasBeenDefined(sim_step))
+            efac[w] = well_efficiency_factor( well, schedule, groupTree, nullptr, sim_step );
     }
 
     return efac;
 }
 
-void Summary::eval( SummaryState& st,
-                    int report_step,
-                    double secs_elapsed,
-                    const EclipseState& es,
-                    const Schedule& schedule,
-                    const data::Wells& wells ,
-                    const std::map<std::string, double>& single_values,
-                    const std::map<std::string, std::vector<double>>& region_values,
-                    const std::map<std::pair<std::string, int>, double>& block_values) const {
+void Summary::internal_eval( SummaryState& st,
+                             int report_step,
+                             double secs_elapsed,
+                             const EclipseState& es,
+                             const Schedule& schedule,
+                             const data::Wells& wells ,
+                             const std::map<std::string, double>& single_values,
+                             const std::map<std::string, std::vector<double>>& region_values) {
 
     if (secs_elapsed < this->prev_time_elapsed) {
         const auto& usys    = es.getUnits();
@@ -1501,6 +1531,14 @@ void Summary::eval( SummaryState& st,
      * necessary to use when consulting the Schedule object. */
     const auto sim_step = std::max( 0, report_step - 1 );
 
+    /*
+      The region rates are summed for all regions up front; the layout of
+      the region connections is only rebuilt when the wells or their
+      connections have changed.
+    */
+    this->regionCache.update( schedule, sim_step );
+    this->regionCache.update_rates( wells, region_efficiency_factors( this->regionCache, schedule, sim_step ));
+
     for( auto& f : this->handlers->handlers ) {
         const int num = smspec_node_get_num( f.first );
         double unit_applied_val = smspec_node_get_default( f.first );
@@ -1573,18 +1611,62 @@ void Summary::eval( SummaryState& st,
         }
     }
 
+}
+
+
+void Summary::eval( SummaryState& st,
+                    int report_step,
+                    double secs_elapsed,
+                    const EclipseState& es,
+                    const Schedule& schedule,
+                    const data::Wells& wells ,
+                    const std::map<std::string, double>& single_values,
+                    const std::map<std::string, std::vector<double>>& region_values,
+                    const std::map<std::pair<std::string, int>, double>& block_values) {
+
+    this->internal_eval(st, report_step, secs_elapsed, es, schedule, wells, single_values, region_values);
+
     for( const auto& value_pair : block_values ) {
-        const std::pair<std::string, int> key = value_pair.first;
-        const auto node_pair = this->handlers->block_nodes.find( key );
-        if (node_pair != this->handlers->block_nodes.end()) {
-            const auto * nodeptr = node_pair->second;
-            const auto unit = block_units.at( key.first );
-            double si_value = value_pair.second;
-            double output_value = es.getUnits().from_si(unit , si_value );
-            st.update(*nodeptr, output_value);
+        const auto index_pair = this->handlers->block_index.find( value_pair.first );
+        if (index_pair != this->handlers->block_index.end()) {
+            const auto index = index_pair->second;
+            double output_value = es.getUnits().from_si(this->handlers->block_measures[index], value_pair.second );
+            st.update(*this->handlers->block_nodes[index], output_value);
         }
     }
-    eval_udq(schedule, sim_step, st);
+
+    eval_udq(schedule, std::max( 0, report_step - 1 ), st);
+}
+
+
+void Summary::eval_blocks( SummaryState& st,
+                           int report_step,
+                           double secs_elapsed,
+                           const EclipseState& es,
+                           const Schedule& schedule,
+                           const data::Wells& wells ,
+                           const std::map<std::string, double>& single_values,
+                           const std::map<std::string, std::vector<double>>& region_values,
+                           const std::vector<double>& block_values) {
+
+    const auto& block_nodes = this->handlers->block_nodes;
+    if (block_values.size() != block_nodes.size())
+        throw std::invalid_argument("Expected " + std::to_string(block_nodes.size()) + " block values, got "
+                                    + std::to_string(block_values.size()));
+
+    this->internal_eval(st, report_step, secs_elapsed, es, schedule, wells, single_values, region_values);
+
+    const auto& units = es.getUnits();
+    const auto& block_measures = this->handlers->block_measures;
+    for (std::size_t index = 0; index < block_nodes.size(); index++)
+        st.update(*block_nodes[index], units.from_si(block_measures[index], block_values[index]));
+
+    eval_udq(schedule, std::max( 0, report_step - 1 ), st);
+}
+
+
+const std::vector<Summary::BlockRequest>& Summary::block_requests() const {
+    return this->handlers->block_requests;
 }
 
 
@@ -1610,6 +1692,9 @@ void Summary::internal_store(const SummaryState& st, int report_step, double sec
           OpmLog::warning("Have configured summary variable " + key + " for summary output - but it has not been calculated");
         */
     }
+
+    this->prev_state = st;
+    this->prev_time_elapsed = secs_elapsed;
 }
 
 
@@ -1624,9 +1709,20 @@ void Summary::add_timestep( int report_step,
     SummaryState st;
     this->eval(st, report_step, secs_elapsed, es, schedule, wells, single_values, region_values, block_values);
     this->internal_store(st, report_step, secs_elapsed);
+}
 
-    this->prev_state = st;
-    this->prev_time_elapsed = secs_elapsed;
+
+void Summary::add_timestep_blocks( int report_step,
+                                   double secs_elapsed,
+                                   const EclipseState& es,
+                                   const Schedule& schedule,
+                                   const data::Wells& wells ,
+                                   const std::map<std::string, double>& single_values,
+                                   const std::map<std::string, std::vector<double>>& region_values,
+                                   const std::vector<double>& block_values) {
+    SummaryState st;
+    this->eval_blocks(st, report_step, secs_elapsed, es, schedule, wells, single_values, region_values, block_values);
+    this->internal_store(st, report_step, secs_elapsed);
 }
 
 
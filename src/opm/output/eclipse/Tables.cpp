@@ -47,6 +47,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <numeric>
@@ -54,6 +55,10 @@
 #include <vector>
 
 namespace {
+    /// Minimum number of sub-tables for which createPropfuncTable() builds
+    /// the sub-tables in parallel.
+    const std::size_t minParallelSubTables = 64;
+
     /// Convenience type alias for a callable entity that extracts the
     /// independent and primary dependent variates of a single property
     /// function table into a linearised output table.  Calling the function
@@ -108,25 +113,26 @@ namespace {
     {
         const auto numCols = 1 + 2*numDep;
 
-        auto descr = ::Opm::DifferentiateOutputTable::Descriptor{};
-
         auto linTable = ::Opm::LinearisedOutputTable {
             numTab, numPrim, numRows, numCols, fillVal
         };
 
-        // Note unusual loop counters here.  Specifically, we mutate the
-        // members of 'descr' rather than using separate counters, which is
-        // the custom construction.  The reason for this is that these
-        // members are also used in calcSlopes() to indicate which table
-        // subsection to analyse and compute derivatives for.  With separate
-        // loop counters, we would need to form a new table descriptor for
-        // each call to calcSlopes().
-        for (descr.tableID = 0*numTab;
-             descr.tableID < 1*numTab; ++descr.tableID)
+        // Each sub-table occupies its own, disjoint part of 'linTable' so
+        // the sub-tables of all tables are built concurrently.  Exceptions
+        // cannot leave the parallel region, so they are stored per
+        // sub-table and the one from the lowest numbered sub-table is
+        // rethrown afterwards--i.e., the same one as in a serial run.
+        const auto numSubTables = numTab * numPrim;
+        auto errors = std::vector<std::exception_ptr>(numSubTables);
+
+#pragma omp parallel for if (numSubTables > minParallelSubTables)
+        for (long subTable = 0; subTable < static_cast<long>(numSubTables); ++subTable)
         {
-            for (descr.primID = 0*numPrim;
-                 descr.primID < 1*numPrim; ++descr.primID)
-            {
+            auto descr = ::Opm::DifferentiateOutputTable::Descriptor{};
+            descr.tableID = subTable / numPrim;
+            descr.primID  = subTable % numPrim;
+
+            try {
                 descr.numActRows =
                     buildDeps(descr.tableID, descr.primID, linTable);
 
@@ -139,6 +145,15 @@ namespace {
                 //    from namespace ::Opm::DifferentiateOutputTable.
                 calcSlopes(numDep, descr, linTable);
             }
+            catch (...) {
+                errors[subTable] = std::current_exception();
+            }
+        }
+
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
         }
 
         return linTable.getDataDestructively();
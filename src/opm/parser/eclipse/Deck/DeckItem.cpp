@@ -253,9 +253,23 @@ double DeckItem::getSIDouble( size_t index ) const {
 
 const std::vector< double >& DeckItem::getSIDoubleData() const {
     const auto& raw = this->value_ref< double >();
-    // we already converted this item to SI?
-    if( !this->SIdata.empty() ) return this->SIdata;
 
+    /*
+     * The conversion runs at most once per item, also when several threads
+     * ask for the SI data of the same item. If it throws the item is left
+     * unconverted, and the next call tries again.
+     */
+    if( !this->SIconversion.done ) {
+        std::lock_guard< std::mutex > lock( this->SIconversion.mutex );
+        if( !this->SIconversion.done ) {
+            this->convertSIData( raw );
+            this->SIconversion.done = true;
+        }
+    }
+    return this->SIdata;
+}
+
+void DeckItem::convertSIData( const std::vector< double >& raw ) const {
     if( this->dimensions.empty() )
         throw std::invalid_argument("No dimension has been set for item'"
                                     + this->name()
@@ -267,15 +281,23 @@ const std::vector< double >& DeckItem::getSIDoubleData() const {
      */
     const auto dim_size = dimensions.size();
     const auto sz = raw.size();
-    this->SIdata.resize( sz );
+    std::vector< double > si( sz );
 
-    for( size_t index = 0; index < sz; index++ ) {
-        const auto dimIndex = index % dim_size;
-        this->SIdata[ index ] = this->dimensions[ dimIndex ]
-                                .convertRawToSi( raw[ index ] );
+    /*
+     * The dimensions repeat with period dim_size, so the values of one
+     * dimension are converted with a strided loop with the scaling and
+     * offset of that dimension. getSIScaling() throws for context
+     * dependent units, before SIdata is assigned.
+     */
+    for( size_t dimIndex = 0; dimIndex < std::min( dim_size, sz ); dimIndex++ ) {
+        const auto& dim = this->dimensions[ dimIndex ];
+        const double factor = dim.getSIScaling();
+        const double offset = dim.getSIOffset();
+        for( size_t index = dimIndex; index < sz; index += dim_size )
+            si[ index ] = raw[ index ]*factor + offset;
     }
 
-    return this->SIdata;
+    this->SIdata = std::move( si );
 }
 
 void DeckItem::push_backDimension( const Dimension& active,
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <memory>
 #include <set>
 
 #include <opm/parser/eclipse/Deck/Deck.hpp>
@@ -78,6 +79,15 @@ namespace Opm {
                 const auto& ntg =  doubleGridProperties->getKeyword("NTG");
 
                 const auto& poroData = poro.getData();
+
+                /*
+                  Normally all the cells get their pore volume from PORO, then
+                  the volumes are calculated for the whole grid in one go.
+                */
+                std::vector<double> cell_volumes;
+                if (std::any_of(values.begin(), values.end(), [](double v) { return !std::isfinite(v); }))
+                    cell_volumes = eclipseGrid->getCellVolumes();
+
                 for (size_t globalIndex = 0; globalIndex < poro.getCartesianSize(); globalIndex++) {
                     if (!std::isfinite(values[globalIndex])) {
                         double cell_poro = poroData[globalIndex];
@@ -85,7 +95,7 @@ namespace Opm {
                             throw std::logic_error("Some cells neither specify the PORV keyword nor PORO");
 
                         double cell_ntg = ntg.iget(globalIndex);
-                        double cell_volume = eclipseGrid->getCellVolume(globalIndex);
+                        double cell_volume = cell_volumes[globalIndex];
                         values[globalIndex] = cell_poro * cell_volume * cell_ntg;
                     }
                 }
@@ -225,45 +235,56 @@ namespace Opm {
     static std::vector< GridProperties< double >::SupportedKeywordInfo >
     makeSupportedDoubleKeywords(const TableManager*        tableManager,
                                 const EclipseGrid*         eclipseGrid,
-                                GridProperties<int>* intGridProperties)
+                                GridProperties<int>* intGridProperties,
+                                const std::shared_ptr< SatfuncEndpointCache >& endpoints)
     {
         using std::placeholders::_1;
 
-        const auto SGLLookup    = std::bind( SGLEndpoint,    _1, tableManager, eclipseGrid, intGridProperties );
-        const auto ISGLLookup   = std::bind( ISGLEndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto SWLLookup    = std::bind( SWLEndpoint,    _1, tableManager, eclipseGrid, intGridProperties );
-        const auto ISWLLookup   = std::bind( ISWLEndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto SGULookup    = std::bind( SGUEndpoint,    _1, tableManager, eclipseGrid, intGridProperties );
-        const auto ISGULookup   = std::bind( ISGUEndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto SWULookup    = std::bind( SWUEndpoint,    _1, tableManager, eclipseGrid, intGridProperties );
-        const auto ISWULookup   = std::bind( ISWUEndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto SGCRLookup   = std::bind( SGCREndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto ISGCRLookup  = std::bind( ISGCREndpoint,  _1, tableManager, eclipseGrid, intGridProperties );
-        const auto SOWCRLookup  = std::bind( SOWCREndpoint,  _1, tableManager, eclipseGrid, intGridProperties );
-        const auto ISOWCRLookup = std::bind( ISOWCREndpoint, _1, tableManager, eclipseGrid, intGridProperties );
-        const auto SOGCRLookup  = std::bind( SOGCREndpoint,  _1, tableManager, eclipseGrid, intGridProperties );
-        const auto ISOGCRLookup = std::bind( ISOGCREndpoint, _1, tableManager, eclipseGrid, intGridProperties );
-        const auto SWCRLookup   = std::bind( SWCREndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto ISWCRLookup  = std::bind( ISWCREndpoint,  _1, tableManager, eclipseGrid, intGridProperties );
-
-        const auto PCWLookup    = std::bind( PCWEndpoint,    _1, tableManager, eclipseGrid, intGridProperties );
-        const auto IPCWLookup   = std::bind( IPCWEndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto PCGLookup    = std::bind( PCGEndpoint,    _1, tableManager, eclipseGrid, intGridProperties );
-        const auto IPCGLookup   = std::bind( IPCGEndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto KRWLookup    = std::bind( KRWEndpoint,    _1, tableManager, eclipseGrid, intGridProperties );
-        const auto IKRWLookup   = std::bind( IKRWEndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto KRWRLookup   = std::bind( KRWREndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto IKRWRLookup  = std::bind( IKRWREndpoint,  _1, tableManager, eclipseGrid, intGridProperties );
-        const auto KROLookup    = std::bind( KROEndpoint,    _1, tableManager, eclipseGrid, intGridProperties );
-        const auto IKROLookup   = std::bind( IKROEndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto KRORWLookup  = std::bind( KRORWEndpoint,  _1, tableManager, eclipseGrid, intGridProperties );
-        const auto IKRORWLookup = std::bind( IKRORWEndpoint, _1, tableManager, eclipseGrid, intGridProperties );
-        const auto KRORGLookup  = std::bind( KRORGEndpoint,  _1, tableManager, eclipseGrid, intGridProperties );
-        const auto IKRORGLookup = std::bind( IKRORGEndpoint, _1, tableManager, eclipseGrid, intGridProperties );
-        const auto KRGLookup    = std::bind( KRGEndpoint,    _1, tableManager, eclipseGrid, intGridProperties );
-        const auto IKRGLookup   = std::bind( IKRGEndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto KRGRLookup   = std::bind( KRGREndpoint,   _1, tableManager, eclipseGrid, intGridProperties );
-        const auto IKRGRLookup  = std::bind( IKRGREndpoint,  _1, tableManager, eclipseGrid, intGridProperties );
+        /*
+          The endpoint scaling keywords share one cache, so the endpoint
+          arrays of the requested keywords are computed in one pass over the
+          grid.
+        */
+        const auto endpointLookup = [endpoints]( const std::string& keyword ) {
+            return GridProperties< double >::SupportedKeywordInfo::init(
+                [endpoints, keyword]( size_t size ) { return endpoints->get( keyword, size ); } );
+        };
+
+        const auto SGLLookup    = endpointLookup( "SGL" );
+        const auto ISGLLookup   = endpointLookup( "ISGL" );
+        const auto SWLLookup    = endpointLookup( "SWL" );
+        const auto ISWLLookup   = endpointLookup( "ISWL" );
+        const auto SGULookup    = endpointLookup( "SGU" );
+        const auto ISGULookup   = endpointLookup( "ISGU" );
+        const auto SWULookup    = endpointLookup( "SWU" );
+        const auto ISWULookup   = endpointLookup( "ISWU" );
+        const auto SGCRLookup   = endpointLookup( "SGCR" );
+        const auto ISGCRLookup  = endpointLookup( "ISGCR" );
+        const auto SOWCRLookup  = endpointLookup( "SOWCR" );
+        const auto ISOWCRLookup = endpointLookup( "ISOWCR" );
+        const auto SOGCRLookup  = endpointLookup( "SOGCR" );
+        const auto ISOGCRLookup = endpointLookup( "ISOGCR" );
+        const auto SWCRLookup   = endpointLookup( "SWCR" );
+        const auto ISWCRLookup  = endpointLookup( "ISWCR" );
+
+        const auto PCWLookup    = endpointLookup( "PCW" );
+        const auto IPCWLookup   = endpointLookup( "IPCW" );
+        const auto PCGLookup    = endpointLookup( "PCG" );
+        const auto IPCGLookup   = endpointLookup( "IPCG" );
+        const auto KRWLookup    = endpointLookup( "KRW" );
+        const auto IKRWLookup   = endpointLookup( "IKRW" );
+        const auto KRWRLookup   = endpointLookup( "KRWR" );
+        const auto IKRWRLookup  = endpointLookup( "IKRWR" );
+        const auto KROLookup    = endpointLookup( "KRO" );
+        const auto IKROLookup   = endpointLookup( "IKRO" );
+        const auto KRORWLookup  = endpointLookup( "KRORW" );
+        const auto IKRORWLookup = endpointLookup( "IKRORW" );
+        const auto KRORGLookup  = endpointLookup( "KRORG" );
+        const auto IKRORGLookup = endpointLookup( "IKRORG" );
+        const auto KRGLookup    = endpointLookup( "KRG" );
+        const auto IKRGLookup   = endpointLookup( "IKRG" );
+        const auto KRGRLookup   = endpointLookup( "KRGR" );
+        const auto IKRGRLookup  = endpointLookup( "IKRGR" );
 
         const auto tempLookup = std::bind( temperature_lookup, _1, tableManager, eclipseGrid, intGridProperties );
 
@@ -471,8 +492,9 @@ namespace Opm {
         // supported. (and hopefully never will be)
         // register the grid properties
         m_intGridProperties(eclipseGrid, makeSupportedIntKeywords()),
+        m_satfuncEndpoints(std::make_shared< SatfuncEndpointCache >(&tableManager, &eclipseGrid, &m_intGridProperties)),
         m_doubleGridProperties(eclipseGrid, &unit_system,
-                               makeSupportedDoubleKeywords(&tableManager, &eclipseGrid, &m_intGridProperties))
+                               makeSupportedDoubleKeywords(&tableManager, &eclipseGrid, &m_intGridProperties, m_satfuncEndpoints))
     {
     }
 
@@ -487,8 +509,9 @@ namespace Opm {
           // supported. (and hopefully never will be)
           // register the grid properties
           m_intGridProperties(eclipseGrid, makeSupportedIntKeywords()),
+          m_satfuncEndpoints(std::make_shared< SatfuncEndpointCache >(&tableManager, &eclipseGrid, &m_intGridProperties)),
           m_doubleGridProperties(eclipseGrid, &m_deckUnitSystem,
-                                 makeSupportedDoubleKeywords(&tableManager, &eclipseGrid, &m_intGridProperties))
+                                 makeSupportedDoubleKeywords(&tableManager, &eclipseGrid, &m_intGridProperties, m_satfuncEndpoints))
     {
         /*
          * The EQUALREG, MULTREG, COPYREG, ... keywords are used to manipulate
@@ -556,7 +579,15 @@ namespace Opm {
                                                 true );
         }
 
+        requestDeckSatfuncEndpoints(deck);
         processGridProperties(deck, eclipseGrid);
+
+        /*
+          The integer properties are typically region properties which are
+          constant over large parts of the grid; they are kept in compact
+          form until someone needs the dense data.
+        */
+        m_intGridProperties.compress();
     }
 
     bool Eclipse3DProperties::supportsGridProperty(const std::string& keyword) const {
@@ -565,6 +596,38 @@ namespace Opm {
 
 
 
+    void Eclipse3DProperties::requestSatfuncEndpoints(const std::vector<std::string>& keywords) const {
+        if (m_satfuncEndpoints)
+            m_satfuncEndpoints->request( keywords );
+    }
+
+
+    /*
+      The grid properties which are mentioned in the deck, either as a
+      keyword of their own or as an argument to one of the operation
+      keywords. The endpoint properties among them are announced to the
+      endpoint cache before the deck is processed.
+    */
+    void Eclipse3DProperties::requestDeckSatfuncEndpoints(const Deck& deck) const {
+        static const std::set<std::string> operations = {"ADD", "COPY", "EQUALS", "MAXVALUE", "MINVALUE", "MULTIPLY",
+                                                         "ADDREG", "COPYREG", "EQUALREG", "MULTIREG", "OPERATE", "OPERATER"};
+        std::vector<std::string> keywords;
+        for (const auto& deckKeyword : deck) {
+            if (m_doubleGridProperties.supportsKeyword( deckKeyword.name() ))
+                keywords.push_back( deckKeyword.name() );
+            else if (operations.count( deckKeyword.name() ) > 0) {
+                for (const auto& record : deckKeyword) {
+                    for (const auto& item : record) {
+                        if (item.getType() == type_tag::string && item.size() > 0 && !item.defaultApplied(0))
+                            keywords.push_back( item.get< std::string >(0) );
+                    }
+                }
+            }
+        }
+        requestSatfuncEndpoints( keywords );
+    }
+
+
     bool Eclipse3DProperties::hasDeckIntGridProperty(const std::string& keyword) const {
         if (!m_intGridProperties.supportsKeyword( keyword ))
             throw std::logic_error("Integer grid property " + keyword + " is unsupported!");
@@ -603,6 +666,23 @@ namespace Opm {
         return m_doubleGridProperties;
     }
 
+    void Eclipse3DProperties::setMemoryBudget(std::size_t bytes) {
+        m_intGridProperties.setMemoryBudget( bytes );
+        m_doubleGridProperties.setMemoryBudget( bytes );
+    }
+
+    std::size_t Eclipse3DProperties::enforceMemoryBudget() {
+        return m_intGridProperties.enforceMemoryBudget() + m_doubleGridProperties.enforceMemoryBudget();
+    }
+
+    std::size_t Eclipse3DProperties::memoryUsage() const {
+        return m_intGridProperties.memoryUsage() + m_doubleGridProperties.memoryUsage();
+    }
+
+    std::size_t Eclipse3DProperties::compress() {
+        return m_intGridProperties.compress() + m_doubleGridProperties.compress();
+    }
+
 
     std::string Eclipse3DProperties::getDefaultRegionKeyword() const {
         return m_defaultRegion;
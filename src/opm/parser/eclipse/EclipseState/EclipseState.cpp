@@ -17,7 +17,10 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <chrono>
+#include <future>
 #include <set>
+#include <sstream>
 
 #include <boost/algorithm/string/join.hpp>
 
@@ -50,14 +53,92 @@
 namespace Opm {
 
 
-    EclipseState::EclipseState(const Deck& deck , const ParseContext& parseContext, ErrorGuard& errors) :
-        m_tables(            deck ),
-        m_runspec(           deck ),
+    /*
+      The tables, the runspec, the NNC/EDITNNC input and the input grid only
+      read the deck, and are independent of each other. They are created as
+      tasks which are either launched asynchronously, or deferred - in which
+      case they are evaluated in the member initializer list in the same
+      order as before. The remaining components depend on the grid and the
+      tables, and are created sequentially:
+
+         tables ---------+
+                         +--> 3D properties --> simulation config
+         grid -----------+                  --> transmissibility multipliers
+         runspec, NNC, EDITNNC
+
+      The EclipseConfig is created by the calling thread while the tasks are
+      running, because the ErrorGuard is not thread safe.
+
+      All the tasks read the same const Deck concurrently. This requires
+      that the const methods of the deck are safe to call from several
+      threads. The only state filled lazily from const methods is the SI
+      data of a DeckItem, and getSIDoubleData() fills it under a mutex.
+      Any new lazily filled state in the deck must be protected the same
+      way, or be filled before the tasks are launched.
+    */
+
+    struct EclipseState::InitTasks {
+        using clock = std::chrono::steady_clock;
+
+        InitTasks(const Deck& deck, bool parallel) :
+            start(clock::now())
+        {
+            auto policy = parallel ? std::launch::async : std::launch::deferred;
+
+            this->tables   = std::async(policy, [&deck, this]() { return timed<TableManager>(deck, this->tables_time); });
+            this->runspec  = std::async(policy, [&deck, this]() { return timed<Runspec>(deck, this->runspec_time); });
+            this->nnc      = std::async(policy, [&deck, this]() { return timed<NNC>(deck, this->nnc_time); });
+            this->editnnc  = std::async(policy, [&deck, this]() { return timed<EDITNNC>(deck, this->editnnc_time); });
+            this->grid     = std::async(policy, [&deck, this]() { return timed<EclipseGrid>(deck, this->grid_time); });
+        }
+
+        template <typename T>
+        static T timed(const Deck& deck, double& seconds) {
+            auto t0 = clock::now();
+            T value(deck);
+            seconds = std::chrono::duration<double>(clock::now() - t0).count();
+            return value;
+        }
+
+        std::string report() const {
+            std::ostringstream os;
+            os << "EclipseState created in " << std::chrono::duration<double>(clock::now() - this->start).count() << " s"
+               << " (tables: " << this->tables_time << " s"
+               << ", runspec: " << this->runspec_time << " s"
+               << ", nnc: " << this->nnc_time << " s"
+               << ", editnnc: " << this->editnnc_time << " s"
+               << ", grid: " << this->grid_time << " s)";
+            return os.str();
+        }
+
+        clock::time_point start;
+        double tables_time = 0;
+        double runspec_time = 0;
+        double nnc_time = 0;
+        double editnnc_time = 0;
+        double grid_time = 0;
+
+        std::future<TableManager> tables;
+        std::future<Runspec> runspec;
+        std::future<NNC> nnc;
+        std::future<EDITNNC> editnnc;
+        std::future<EclipseGrid> grid;
+    };
+
+
+    EclipseState::EclipseState(const Deck& deck , const ParseContext& parseContext, ErrorGuard& errors, bool parallel_init) :
+        EclipseState(deck, parseContext, errors, InitTasks(deck, parallel_init))
+    {}
+
+
+    EclipseState::EclipseState(const Deck& deck , const ParseContext& parseContext, ErrorGuard& errors, InitTasks&& tasks) :
+        m_tables(            tasks.tables.get() ),
+        m_runspec(           tasks.runspec.get() ),
         m_eclipseConfig(     deck, parseContext, errors ),
         m_deckUnitSystem(    deck.getActiveUnitSystem() ),
-        m_inputNnc(          deck ),
-        m_inputEditNnc(      deck ),
-        m_inputGrid(         deck, nullptr ),
+        m_inputNnc(          tasks.nnc.get() ),
+        m_inputEditNnc(      tasks.editnnc.get() ),
+        m_inputGrid(         tasks.grid.get() ),
         m_eclipseProperties( deck, m_tables, m_inputGrid ),
         m_simulationConfig(  m_eclipseConfig.getInitConfig().restartRequested(), deck, m_eclipseProperties ),
         m_transMult(         GridDims(deck), deck, m_eclipseProperties )
@@ -77,6 +158,8 @@ namespace Opm {
 
         initTransMult();
         initFaults(deck);
+
+        OpmLog::debug(tasks.report());
     }
 
 
@@ -120,6 +203,14 @@ namespace Opm {
         return m_eclipseProperties;
     }
 
+    void EclipseState::setMemoryBudget(std::size_t bytes) {
+        m_eclipseProperties.setMemoryBudget( bytes );
+    }
+
+    std::size_t EclipseState::enforceMemoryBudget() {
+        return m_eclipseProperties.enforceMemoryBudget();
+    }
+
 
     const TableManager& EclipseState::getTableManager() const {
         return m_tables;
@@ -62,7 +62,6 @@ namespace Opm {
         m_stride[2] = m_dims[0] * m_dims[1];
 
         m_isGlobal = true;
-        initIndexList();
     }
 
 
@@ -87,8 +86,6 @@ namespace Opm {
             m_isGlobal = true;
         else
             m_isGlobal = false;
-
-        initIndexList();
     }
 
 
@@ -118,21 +115,40 @@ namespace Opm {
 
 
     std::vector<size_t>::const_iterator Box::begin() const {
-        return m_indexList.begin();
+        return getIndexList().begin();
     }
 
     std::vector<size_t>::const_iterator Box::end() const {
-        return m_indexList.end();
+        return getIndexList().end();
     }
 
 
     const std::vector<size_t>& Box::getIndexList() const {
-        return m_indexList;
+        std::call_once( *m_indexList.once, [this]() { this->initIndexList(); } );
+        return m_indexList.indices;
+    }
+
+
+    size_t Box::numRuns() const {
+        return m_dims[1] * m_dims[2];
+    }
+
+
+    size_t Box::runLength() const {
+        return m_dims[0];
+    }
+
+
+    size_t Box::runStart(size_t run) const {
+        size_t j = run % m_dims[1] + m_offset[1];
+        size_t k = run / m_dims[1] + m_offset[2];
+        return m_offset[0] * m_stride[0] + j * m_stride[1] + k * m_stride[2];
     }
 
 
-    void Box::initIndexList() {
-        m_indexList.resize( size() );
+    void Box::initIndexList() const {
+        auto& indexList = m_indexList.indices;
+        indexList.resize( size() );
 
         size_t ii,ij,ik;
         size_t l = 0;
@@ -145,7 +161,7 @@ namespace Opm {
                     size_t i = ii + m_offset[0];
                     size_t g = i * m_stride[0] + j*m_stride[1] + k*m_stride[2];
 
-                    m_indexList[l] = g;
+                    indexList[l] = g;
                     l++;
                 }
             }
@@ -68,6 +68,7 @@ namespace Opm {
           volume_cache(dims[0] * dims[1] * dims[2], -1.0)
     {
         initCornerPointGrid( dims, coord , zcorn , actnum , mapaxes );
+        initActiveMaps();
     }
 
 
@@ -94,6 +95,7 @@ namespace Opm {
         m_nz = ecl_grid_get_nz( c_ptr() );
 
         volume_cache.resize(m_nx * m_ny * m_nz, -1.0);
+        initActiveMaps();
     }
 
 
@@ -107,6 +109,7 @@ namespace Opm {
           volume_cache(nx * ny * nz, -1.0),
           m_grid( ecl_grid_alloc_rectangular(nx, ny, nz, dx, dy, dz, NULL) )
     {
+        initActiveMaps();
     }
 
     EclipseGrid::EclipseGrid(const EclipseGrid& src, const double* zcorn , const std::vector<int>& actnum)
@@ -116,10 +119,12 @@ namespace Opm {
           m_pinch( src.m_pinch ),
           m_pinchoutMode( src.m_pinchoutMode ),
           m_multzMode( src.m_multzMode ),
-          volume_cache(src.volume_cache.size(), -1.0)
+          volume_cache(src.volume_cache.size(), -1.0),
+          m_pillar_grid( src.m_pillar_grid )
     {
         const int * actnum_data = (actnum.empty()) ? nullptr : actnum.data();
         m_grid.reset( ecl_grid_alloc_processed_copy( src.c_ptr(), zcorn , actnum_data ));
+        initActiveMaps();
     }
 
 
@@ -174,6 +179,7 @@ namespace Opm {
 
         const std::array<int, 3> dims = getNXYZ();
         initGrid(dims, deck);
+        initActiveMaps();
 
         if (actnum != nullptr)
             resetACTNUM(actnum);
@@ -253,19 +259,19 @@ namespace Opm {
     }
 
     size_t EclipseGrid::activeIndex(size_t globalIndex) const {
-        int active_index = ecl_grid_get_active_index1( m_grid.get() , globalIndex );
+        assertGlobalIndex( globalIndex );
+        int active_index = m_activeMap->globalToActive()[globalIndex];
         if (active_index < 0)
             throw std::invalid_argument("Input argument does not correspond to an active cell");
         return static_cast<size_t>( active_index );
     }
 
-    /**
-       Observe: the input argument is assumed to be in the space
-       [0,num_active).
-    */
     size_t EclipseGrid::getGlobalIndex(size_t active_index) const {
-        int global_index = ecl_grid_get_global_index1A( m_grid.get() , active_index );
-        return static_cast<size_t>(global_index);
+        const auto& active_to_global = m_activeMap->activeToGlobal();
+        if (active_index >= active_to_global.size())
+            throw std::invalid_argument("Active index " + std::to_string(active_index) + " is out of range");
+
+        return static_cast<size_t>( active_to_global[active_index] );
     }
 
     size_t EclipseGrid::getGlobalIndex(size_t i, size_t j, size_t k) const {
@@ -489,6 +495,8 @@ namespace Opm {
 
         if (mapaxes)
             delete[] mapaxes_float;
+
+        m_pillar_grid = true;
     }
 
     void EclipseGrid::initCornerPointGrid(const std::array<int,3>& dims, const Deck& deck) {
@@ -737,7 +745,7 @@ namespace Opm {
 
 
     size_t EclipseGrid::getNumActive( ) const {
-        return static_cast<size_t>(ecl_grid_get_nactive( c_ptr() ));
+        return m_activeMap->activeSize();
     }
 
     bool EclipseGrid::allActive( ) const {
@@ -746,12 +754,12 @@ namespace Opm {
 
     bool EclipseGrid::cellActive( size_t globalIndex ) const {
         assertGlobalIndex( globalIndex );
-        return ecl_grid_cell_active1( c_ptr() , static_cast<int>(globalIndex));
+        return m_activeMap->globalToActive()[globalIndex] >= 0;
     }
 
     bool EclipseGrid::cellActive( size_t i , size_t j , size_t k ) const {
         assertIJK(i,j,k);
-        return ecl_grid_cell_active3( c_ptr() , static_cast<int>(i),static_cast<int>(j),static_cast<int>(k));
+        return m_activeMap->globalToActive()[ getGlobalIndex(i,j,k) ] >= 0;
     }
 
 
@@ -874,6 +882,76 @@ namespace Opm {
 
 
 
+    CellGeometry EclipseGrid::getCellGeometry() const {
+        if (m_pillar_grid) {
+            std::vector<double> coord;
+            std::vector<double> zcorn( ecl_grid_get_zcorn_size( c_ptr() ));
+
+            exportCOORD( coord );
+            ecl_grid_init_zcorn_data_double( c_ptr() , zcorn.data() );
+            auto geometry = calculateCellGeometry( getNX() , getNY() , getNZ() , coord , zcorn );
+            volume_cache = geometry.volume;
+            return geometry;
+        }
+
+        /*
+          Grids created from DX, DY, DZ and TOPS - or loaded from file - do
+          not necessarily have cells which share pillars, we then go through
+          the per cell methods.
+        */
+        const size_t size = getCartesianSize();
+        CellGeometry geometry;
+        geometry.volume = getCellVolumes();
+        geometry.center_x.resize( size );
+        geometry.center_y.resize( size );
+        geometry.depth.resize( size );
+        geometry.thickness.resize( size );
+        for (size_t globalIndex = 0; globalIndex < size; globalIndex++) {
+            const auto center = getCellCenter( globalIndex );
+            geometry.center_x[globalIndex] = center[0];
+            geometry.center_y[globalIndex] = center[1];
+            geometry.depth[globalIndex] = getCellDepth( globalIndex );
+            geometry.thickness[globalIndex] = getCellThicknes( globalIndex );
+        }
+        return geometry;
+    }
+
+
+    std::vector<double> EclipseGrid::getCellVolumes() const {
+        if (m_pillar_grid) {
+            std::vector<double> coord;
+            std::vector<double> zcorn( ecl_grid_get_zcorn_size( c_ptr() ));
+
+            exportCOORD( coord );
+            ecl_grid_init_zcorn_data_double( c_ptr() , zcorn.data() );
+            volume_cache = calculateCellVolumes( getNX() , getNY() , getNZ() , coord , zcorn );
+            return volume_cache;
+        }
+
+        const size_t size = getCartesianSize();
+        for (size_t globalIndex = 0; globalIndex < size; globalIndex++)
+            getCellVolume( globalIndex );
+
+        return volume_cache;
+    }
+
+
+    std::vector<double> EclipseGrid::getCellDepths() const {
+        if (m_pillar_grid) {
+            std::vector<double> zcorn( ecl_grid_get_zcorn_size( c_ptr() ));
+
+            ecl_grid_init_zcorn_data_double( c_ptr() , zcorn.data() );
+            return calculateCellDepths( getNX() , getNY() , getNZ() , zcorn );
+        }
+
+        std::vector<double> depth( getCartesianSize() );
+        for (size_t globalIndex = 0; globalIndex < depth.size(); globalIndex++)
+            depth[globalIndex] = getCellDepth( globalIndex );
+
+        return depth;
+    }
+
+
     void EclipseGrid::exportACTNUM( std::vector<int>& actnum) const {
         size_t volume = getNX() * getNY() * getNZ();
         if (getNumActive() == volume)
@@ -907,10 +985,9 @@ namespace Opm {
         return mapper.fixupZCORN( zcorn );
     }
 
-
     void EclipseGrid::addNNC(const NNC& nnc) {
         int idx = 0;
-        auto* ecl_grid = const_cast< ecl_grid_type* >( this->c_ptr() );
+        auto* ecl_grid = this->mutable_grid();
         for (const NNCdata& n : nnc.nncdata())
             ecl_grid_add_self_nnc( ecl_grid, n.cell1, n.cell2, idx++);
     }
@@ -924,27 +1001,35 @@ namespace Opm {
 
 
     const std::vector<int>& EclipseGrid::getActiveMap() const {
-        if( !this->activeMap.empty() ) return this->activeMap;
+        return m_activeMap->activeToGlobal();
+    }
 
-        this->activeMap.resize( this->getNumActive() );
-        const auto size = int(this->getCartesianSize());
+    const ActiveIndexMap& EclipseGrid::activeIndexMap() const {
+        return *m_activeMap;
+    }
 
-        for( int global_index = 0; global_index < size; global_index++) {
-            // Using the low level C function to get the active index, because the C++
-            // version will throw for inactive cells.
-            int active_index = ecl_grid_get_active_index1( m_grid.get() , global_index );
-            if (active_index >= 0)
-                this->activeMap[ active_index ] = global_index;
-        }
+    void EclipseGrid::resetACTNUM( const int * actnum) {
+        ecl_grid_reset_actnum( this->mutable_grid() , actnum );
+        this->initActiveMaps();
+    }
+
+    ecl_grid_type * EclipseGrid::mutable_grid() {
+        if (this->m_grid.use_count() > 1)
+            this->m_grid.reset( ecl_grid_alloc_copy( this->m_grid.get() ));
 
-        return this->activeMap;
+        return this->m_grid.get();
     }
 
-    void EclipseGrid::resetACTNUM( const int * actnum) {
-        ecl_grid_reset_actnum( m_grid.get() , actnum );
-        /* re-build the active map cache */
-        this->activeMap.clear();
-        this->getActiveMap();
+    void EclipseGrid::initActiveMaps() {
+        const auto size = int(this->getCartesianSize());
+        std::vector<int> actnum( size );
+
+        // Using the low level C function to get the active index, because the C++
+        // version will throw for inactive cells.
+        for( int global_index = 0; global_index < size; global_index++)
+            actnum[global_index] = (ecl_grid_get_active_index1( c_ptr() , global_index ) >= 0) ? 1 : 0;
+
+        m_activeMap = std::make_shared<const ActiveIndexMap>( actnum );
     }
 
     ZcornMapper EclipseGrid::zcornMapper() const {
@@ -989,66 +1074,78 @@ namespace Opm {
         return index(i,j,k,c);
     }
 
+    /*
+      The corners on the four pillars of a cell column are only compared
+      with the corners directly above and below on the same pillar, i.e. the
+      columns can be processed independently. The loops below run over the
+      rows in parallel, and go through the layers in order within each row.
+    */
+
     bool ZcornMapper::validZCORN( const std::vector<double>& zcorn) const {
-        int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
-        for (size_t j=0; j < this->dims[1]; j++)
-            for (size_t i=0; i < this->dims[0]; i++)
-                for (size_t c=0; c < 4; c++)
-                    for (size_t k=0; k < this->dims[2]; k++) {
+        const int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
+        const long ny = this->dims[1];
+        bool valid = true;
+
+#pragma omp parallel for reduction(&&:valid)
+        for (long j=0; j < ny; j++) {
+            for (size_t k=0; k < this->dims[2] && valid; k++) {
+                for (size_t i=0; i < this->dims[0]; i++) {
+                    const size_t cell_offset = i*stride[0] + j*stride[1] + k*stride[2];
+                    for (size_t c=0; c < 4; c++) {
+                        const size_t top = cell_offset + cell_shift[c];
+                        const size_t bottom = cell_offset + cell_shift[c + 4];
+
                         /* Between cells */
                         if (k > 0) {
-                            size_t index1 = this->index(i,j,k-1,c+4);
-                            size_t index2 = this->index(i,j,k,c);
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0)
-                                return false;
+                            const size_t above = bottom - stride[2];
+                            if ((zcorn[top] - zcorn[above]) * sign < 0)
+                                valid = false;
                         }
 
                         /* In cell */
-                        {
-                            size_t index1 = this->index(i,j,k,c);
-                            size_t index2 = this->index(i,j,k,c+4);
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0)
-                                return false;
-                        }
+                        if ((zcorn[bottom] - zcorn[top]) * sign < 0)
+                            valid = false;
                     }
+                }
+            }
+        }
 
-        return true;
+        return valid;
     }
 
 
-
-
     size_t ZcornMapper::fixupZCORN( std::vector<double>& zcorn) {
-        int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
+        const int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
+        const long ny = this->dims[1];
         size_t cells_adjusted = 0;
 
-        for (size_t k=0; k < this->dims[2]; k++)
-            for (size_t j=0; j < this->dims[1]; j++)
-                for (size_t i=0; i < this->dims[0]; i++)
+#pragma omp parallel for reduction(+:cells_adjusted)
+        for (long j=0; j < ny; j++) {
+            for (size_t k=0; k < this->dims[2]; k++) {
+                for (size_t i=0; i < this->dims[0]; i++) {
+                    const size_t cell_offset = i*stride[0] + j*stride[1] + k*stride[2];
                     for (size_t c=0; c < 4; c++) {
+                        const size_t top = cell_offset + cell_shift[c];
+                        const size_t bottom = cell_offset + cell_shift[c + 4];
+
                         /* Cell to cell */
                         if (k > 0) {
-                            size_t index1 = this->index(i,j,k-1,c+4);
-                            size_t index2 = this->index(i,j,k,c);
-
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
-                                zcorn[index2] = zcorn[index1];
+                            const size_t above = bottom - stride[2];
+                            if ((zcorn[top] - zcorn[above]) * sign < 0 ) {
+                                zcorn[top] = zcorn[above];
                                 cells_adjusted++;
                             }
                         }
 
-
                         /* Cell internal */
-                        {
-                            size_t index1 = this->index(i,j,k,c);
-                            size_t index2 = this->index(i,j,k,c+4);
-
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
-                                zcorn[index2] = zcorn[index1];
-                                cells_adjusted++;
-                            }
+                        if ((zcorn[bottom] - zcorn[top]) * sign < 0 ) {
+                            zcorn[bottom] = zcorn[top];
+                            cells_adjusted++;
                         }
                     }
+                }
+            }
+        }
         return cells_adjusted;
     }
 
@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <opm/common/OpmLog/OpmLog.hpp>
@@ -166,7 +167,9 @@ namespace Opm {
     template< typename T >
     const GridProperty<T>& GridProperties<T>::getKeyword(const std::string& keyword) const {
         assertKeyword( keyword );
-        return m_properties.at( keyword );
+        const auto& property = m_properties.at( keyword );
+        property.touch();
+        return property;
     }
 
 
@@ -177,7 +180,9 @@ namespace Opm {
         if (!hasKeyword(kw))
             addAutoGeneratedKeyword_(kw);
 
-        return m_properties.at( kw );
+        auto& property = m_properties.at( kw );
+        property.touch();
+        return property;
     }
 
 
@@ -609,6 +614,66 @@ namespace Opm {
         }
     }
 
+    template< typename T >
+    void GridProperties<T>::setMemoryBudget(std::size_t bytes) {
+        this->m_memoryBudget = bytes;
+    }
+
+    template< typename T >
+    std::size_t GridProperties<T>::memoryUsage() const {
+        std::size_t bytes = 0;
+        for (const auto& pair : this->m_properties)
+            bytes += pair.second.memoryUsage();
+
+        return bytes;
+    }
+
+    template< typename T >
+    std::size_t GridProperties<T>::compress() {
+        std::size_t bytes = 0;
+        for (auto& pair : this->m_properties)
+            bytes += pair.second.compress();
+
+        return bytes;
+    }
+
+    /*
+      Only the properties which can be recreated from their initializer
+      count against the budget; they are released in least recently used
+      order until their memory usage is within the budget.
+    */
+    template< typename T >
+    std::size_t GridProperties<T>::enforceMemoryBudget() {
+        std::size_t released = 0;
+        if (this->m_memoryBudget == 0)
+            return released;
+
+        std::size_t usage = 0;
+        std::vector< GridProperty<T>* > regenerable;
+        for (auto& pair : this->m_properties) {
+            if (pair.second.isRegenerable()) {
+                usage += pair.second.memoryUsage();
+                regenerable.push_back( &pair.second );
+            }
+        }
+
+        std::sort( regenerable.begin(), regenerable.end(),
+                   []( const GridProperty<T>* p1, const GridProperty<T>* p2 ) {
+                       return p1->lastAccess() < p2->lastAccess();
+                   });
+
+        for (auto * property : regenerable) {
+            if (usage <= this->m_memoryBudget)
+                break;
+
+            const auto bytes = property->release();
+            usage -= bytes;
+            released += bytes;
+        }
+
+        return released;
+    }
+
     template< typename T >
     bool GridProperties<T>::isAutoGenerated_(const std::string& keyword) const {
         return m_autoGeneratedProperties.count(keyword) > 0;
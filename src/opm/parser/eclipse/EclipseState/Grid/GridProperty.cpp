@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <stdexcept>
@@ -43,6 +44,55 @@ namespace Opm {
         return []( std::vector< T >& ) { return; };
     }
 
+    /*
+      The access stamps of all the properties are drawn from one clock, so
+      that properties in different containers can be ordered.
+    */
+    static std::atomic< std::size_t > access_clock{ 0 };
+
+    /*
+      The box operations are applied to the contiguous runs of the box, in
+      parallel for large boxes. The global box is one contiguous range.
+    */
+    static const long min_parallel_size = 100000;
+
+    template< typename T, typename F >
+    static void apply_box( std::vector< T >& data, const Box& box, F op ) {
+        if (box.isGlobal()) {
+            const long size = data.size();
+            T * values = data.data();
+#pragma omp parallel for if (size >= min_parallel_size)
+            for (long g = 0; g < size; g++)
+                values[g] = op(values[g]);
+        } else {
+            const long num_runs = box.numRuns();
+            const size_t run_length = box.runLength();
+            const bool parallel = box.size() >= static_cast<size_t>(min_parallel_size);
+#pragma omp parallel for if (parallel)
+            for (long run = 0; run < num_runs; run++) {
+                T * values = data.data() + box.runStart(run);
+                for (size_t i = 0; i < run_length; i++)
+                    values[i] = op(values[i]);
+            }
+        }
+    }
+
+    template< typename T >
+    static void copy_box( std::vector< T >& target, const std::vector< T >& src, const Box& box ) {
+        if (box.isGlobal())
+            std::copy(src.begin(), src.end(), target.begin());
+        else {
+            const long num_runs = box.numRuns();
+            const size_t run_length = box.runLength();
+            const bool parallel = box.size() >= static_cast<size_t>(min_parallel_size);
+#pragma omp parallel for if (parallel)
+            for (long run = 0; run < num_runs; run++) {
+                const size_t start = box.runStart(run);
+                std::copy(src.begin() + start, src.begin() + start + run_length, target.begin() + start);
+            }
+        }
+    }
+
     template< typename T >
     GridPropertySupportedKeywordInfo< T >::GridPropertySupportedKeywordInfo(
             const std::string& name,
@@ -134,7 +184,7 @@ namespace Opm {
 
     template< typename T >
     size_t GridProperty< T >::getCartesianSize() const {
-        return m_data.size();
+        return m_nx * m_ny * m_nz;
     }
 
     template< typename T >
@@ -159,6 +209,14 @@ namespace Opm {
 
     template< typename T >
     T GridProperty< T >::iget( size_t index ) const {
+        if (!this->m_materialized.done && this->m_compact) {
+            if (index >= this->getCartesianSize())
+                throw std::out_of_range("Index " + std::to_string(index) + " out of range for " + this->getKeywordName());
+
+            return this->m_runValue[ this->runIndex(index) ];
+        }
+
+        this->materialize();
         return this->m_data.at( index );
     }
 
@@ -170,6 +228,7 @@ namespace Opm {
 
     template< typename T >
     void GridProperty< T >::iset(size_t index, T value) {
+        this->pin();
         this->m_data.at( index ) = value;
     }
 
@@ -181,18 +240,22 @@ namespace Opm {
 
     template< typename T >
     const std::vector< T >& GridProperty< T >::getData() const {
+        this->materialize();
         return m_data;
     }
 
 
     template< typename T >
     std::vector< T >& GridProperty< T >::getData() {
+        this->pin();
         return m_data;
     }
 
     template< typename T >
     void GridProperty< T >::multiplyWith( const GridProperty< T >& other ) {
         if ((m_nx == other.m_nx) && (m_ny == other.m_ny) && (m_nz == other.m_nz)) {
+            this->pin();
+            other.materialize();
             for (size_t g=0; g < m_data.size(); g++)
                 m_data[g] *= other.m_data[g];
         } else
@@ -201,6 +264,7 @@ namespace Opm {
 
     template< typename T >
     void GridProperty< T >::multiplyValueAtIndex(size_t index, T factor) {
+        this->pin();
         m_data[index] *= factor;
     }
 
@@ -208,6 +272,7 @@ namespace Opm {
 
     template< typename T >
     void GridProperty< T >::maskedSet( T value, const std::vector< bool >& mask ) {
+        this->pin();
         for (size_t g = 0; g < getCartesianSize(); g++) {
             if (mask[g])
                 m_data[g] = value;
@@ -217,6 +282,7 @@ namespace Opm {
 
     template< typename T >
     void GridProperty< T >::maskedMultiply( T value, const std::vector<bool>& mask ) {
+        this->pin();
         for (size_t g = 0; g < getCartesianSize(); g++) {
             if (mask[g])
                 m_data[g] *= value;
@@ -226,6 +292,7 @@ namespace Opm {
 
     template< typename T >
     void GridProperty< T >::maskedAdd( T value, const std::vector<bool>& mask ) {
+        this->pin();
         for (size_t g = 0; g < getCartesianSize(); g++) {
             if (mask[g])
                 m_data[g] += value;
@@ -234,6 +301,8 @@ namespace Opm {
 
     template< typename T >
     void GridProperty< T >::maskedCopy( const GridProperty< T >& other, const std::vector< bool >& mask) {
+        this->pin();
+        other.materialize();
         for (size_t g = 0; g < getCartesianSize(); g++) {
             if (mask[g])
                 m_data[g] = other.m_data[g];
@@ -243,6 +312,18 @@ namespace Opm {
 
     template< typename T >
     void GridProperty< T >::initMask( T value, std::vector< bool >& mask ) const {
+        if (!this->m_materialized.done && this->m_compact) {
+            mask.assign(getCartesianSize(), false);
+            for (size_t run = 0; run < this->m_runStart.size(); run++) {
+                if (this->m_runValue[run] == value) {
+                    size_t end = (run + 1 < this->m_runStart.size()) ? this->m_runStart[run + 1] : getCartesianSize();
+                    std::fill(mask.begin() + this->m_runStart[run], mask.begin() + end, true);
+                }
+            }
+            return;
+        }
+
+        this->materialize();
         mask.resize(getCartesianSize());
         for (size_t g = 0; g < getCartesianSize(); g++) {
             if (m_data[g] == value)
@@ -254,6 +335,7 @@ namespace Opm {
 
     template< typename T >
     void GridProperty< T >::loadFromDeckKeyword( const DeckKeyword& deckKeyword ) {
+        this->pin();
         const auto& deckItem = getDeckItem(deckKeyword);
         const auto size = deckItem.size();
         for (size_t dataPointIdx = 0; dataPointIdx < size; ++dataPointIdx) {
@@ -269,19 +351,20 @@ namespace Opm {
         if (inputBox.isGlobal())
             loadFromDeckKeyword( deckKeyword );
         else {
+            this->pin();
             const auto& deckItem = getDeckItem(deckKeyword);
-            const std::vector<size_t>& indexList = inputBox.getIndexList();
-            if (indexList.size() == deckItem.size()) {
-                for (size_t sourceIdx = 0; sourceIdx < indexList.size(); sourceIdx++) {
-                    size_t targetIdx = indexList[sourceIdx];
-                    if (sourceIdx < deckItem.size()
-                        && !deckItem.defaultApplied(sourceIdx))
-                        {
-                            setDataPoint(sourceIdx, targetIdx, deckItem);
-                        }
+            if (inputBox.size() == deckItem.size()) {
+                const size_t run_length = inputBox.runLength();
+                size_t sourceIdx = 0;
+                for (size_t run = 0; run < inputBox.numRuns(); run++) {
+                    const size_t start = inputBox.runStart(run);
+                    for (size_t i = 0; i < run_length; i++, sourceIdx++) {
+                        if (!deckItem.defaultApplied(sourceIdx))
+                            setDataPoint(sourceIdx, start + i, deckItem);
+                    }
                 }
             } else {
-                std::string boxSize = std::to_string(static_cast<long long>(indexList.size()));
+                std::string boxSize = std::to_string(static_cast<long long>(inputBox.size()));
                 std::string keywordSize = std::to_string(static_cast<long long>(deckItem.size()));
 
                 throw std::invalid_argument("Size mismatch: Box:" + boxSize + "  DeckKeyword:" + keywordSize);
@@ -291,86 +374,62 @@ namespace Opm {
 
     template< typename T >
     void GridProperty< T >::copyFrom( const GridProperty< T >& src, const Box& inputBox ) {
-        if (inputBox.isGlobal()) {
-            for (size_t i = 0; i < src.getCartesianSize(); ++i)
-                m_data[i] = src.m_data[i];
-        } else {
-            const std::vector<size_t>& indexList = inputBox.getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] = src.m_data[targetIndex];
-            }
-        }
+        this->pin();
+        src.materialize();
+        copy_box( m_data, src.m_data, inputBox );
         this->assigned = src.deckAssigned();
     }
 
     template< typename T >
     void GridProperty< T >::maxvalue( T value, const Box& inputBox ) {
-        if (inputBox.isGlobal()) {
-            for (size_t i = 0; i < m_data.size(); ++i)
-                m_data[i] = std::min(value,m_data[i]);
-        } else {
-            const std::vector<size_t>& indexList = inputBox.getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] = std::min(value,m_data[targetIndex]);
-            }
-        }
+        auto op = [value](T v) { return std::min(value, v); };
+        if (this->updateCompact(inputBox, op))
+            return;
+
+        this->pin();
+        apply_box( m_data, inputBox, op );
     }
 
     template< typename T >
     void GridProperty< T >::minvalue( T value, const Box& inputBox ) {
-        if (inputBox.isGlobal()) {
-            for (size_t i = 0; i < m_data.size(); ++i)
-                m_data[i] = std::max(value,m_data[i]);
-        } else {
-            const std::vector<size_t>& indexList = inputBox.getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] = std::max(value,m_data[targetIndex]);
-            }
-        }
+        auto op = [value](T v) { return std::max(value, v); };
+        if (this->updateCompact(inputBox, op))
+            return;
+
+        this->pin();
+        apply_box( m_data, inputBox, op );
     }
 
     template< typename T >
     void GridProperty< T >::scale( T scaleFactor, const Box& inputBox ) {
-        if (inputBox.isGlobal()) {
-            for (size_t i = 0; i < m_data.size(); ++i)
-                m_data[i] *= scaleFactor;
-        } else {
-            const std::vector<size_t>& indexList = inputBox.getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] *= scaleFactor;
-            }
-        }
+        auto op = [scaleFactor](T v) { return v * scaleFactor; };
+        if (this->updateCompact(inputBox, op))
+            return;
+
+        this->pin();
+        apply_box( m_data, inputBox, op );
     }
 
     template< typename T >
     void GridProperty< T >::add( T shiftValue, const Box& inputBox ) {
-        if (inputBox.isGlobal()) {
-            for (size_t i = 0; i < m_data.size(); ++i)
-                m_data[i] += shiftValue;
-        } else {
-            const std::vector<size_t>& indexList = inputBox.getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] += shiftValue;
-            }
-        }
+        auto op = [shiftValue](T v) { return v + shiftValue; };
+        if (this->updateCompact(inputBox, op))
+            return;
+
+        this->pin();
+        apply_box( m_data, inputBox, op );
     }
 
     template< typename T >
     void GridProperty< T >::setScalar( T value, const Box& inputBox ) {
-        if (inputBox.isGlobal()) {
-            std::fill(m_data.begin(), m_data.end(), value);
-        } else {
-            const std::vector<size_t>& indexList = inputBox.getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] = value;
-            }
+        auto op = [value](T) { return value; };
+        if (this->updateCompact(inputBox, op)) {
+            this->assigned = true;
+            return;
         }
+
+        this->pin();
+        apply_box( m_data, inputBox, op );
         this->assigned = true;
     }
 
@@ -388,12 +447,201 @@ namespace Opm {
     template< typename T >
     void GridProperty< T >::runPostProcessor() {
         if( this->m_hasRunPostProcessor ) return;
+        const bool compact = this->isCompact();
+        this->materialize();
         this->m_hasRunPostProcessor = true;
         this->m_kwInfo.postProcessor()( m_data );
+        if (compact)
+            this->compress();
+    }
+
+    /*
+      The const accessors end up here, possibly from several threads at
+      once: the data is built under the lock and published through the
+      atomic flag. The runs of a compact property are left in place, since
+      other readers may still be using them; they are dropped by the next
+      non-const operation.
+    */
+    template< typename T >
+    void GridProperty< T >::materialize() const {
+        if (this->m_materialized.done)
+            return;
+
+        std::lock_guard< std::mutex > lock( this->m_materialized.mutex );
+        if (this->m_materialized.done)
+            return;
+
+        if (this->m_compact) {
+            this->m_data.resize( this->getCartesianSize() );
+            for (size_t run = 0; run < this->m_runStart.size(); run++) {
+                size_t end = (run + 1 < this->m_runStart.size()) ? this->m_runStart[run + 1] : this->m_data.size();
+                std::fill(this->m_data.begin() + this->m_runStart[run], this->m_data.begin() + end, this->m_runValue[run]);
+            }
+        } else {
+            this->m_data = this->m_kwInfo.initializer()( this->getCartesianSize() );
+            if (this->m_hasRunPostProcessor)
+                this->m_kwInfo.postProcessor()( this->m_data );
+        }
+
+        this->m_materialized.done = true;
+    }
+
+    template< typename T >
+    void GridProperty< T >::pin() {
+        this->materialize();
+        this->m_regenerable = false;
+        this->m_compact = false;
+        std::vector<size_t>().swap( this->m_runStart );
+        std::vector<T>().swap( this->m_runValue );
+    }
+
+    template< typename T >
+    void GridProperty< T >::setRuns() const {
+        this->m_runStart.clear();
+        this->m_runValue.clear();
+        for (size_t g = 0; g < this->m_data.size(); g++) {
+            if (g == 0 || !(this->m_data[g] == this->m_runValue.back())) {
+                this->m_runStart.push_back( g );
+                this->m_runValue.push_back( this->m_data[g] );
+            }
+        }
+        this->m_runStart.shrink_to_fit();
+        this->m_runValue.shrink_to_fit();
+    }
+
+    template< typename T >
+    size_t GridProperty< T >::runIndex(size_t index) const {
+        auto iter = std::upper_bound(this->m_runStart.begin(), this->m_runStart.end(), index);
+        return std::distance(this->m_runStart.begin(), iter) - 1;
+    }
+
+    /*
+      Operations which only depend on the current value are applied to the
+      runs, i.e. the property stays compact. For the global box the values
+      of the runs are updated in place, otherwise the runs of the box are
+      merged with the runs of the property in one pass. If the box breaks
+      the property into so many runs that the dense vector is smaller, the
+      property is expanded.
+    */
+    template< typename T >
+    template< typename F >
+    bool GridProperty< T >::updateCompact(const Box& inputBox, F op) {
+        if (this->m_materialized.done || !this->m_compact)
+            return false;
+
+        this->m_regenerable = false;
+        if (inputBox.isGlobal()) {
+            for (auto& value : this->m_runValue)
+                value = op(value);
+            return true;
+        }
+
+        const size_t size = this->getCartesianSize();
+        std::vector<size_t> run_start;
+        std::vector<T> run_value;
+        size_t run = 0;
+        size_t pos = 0;
+        auto append_until = [&](size_t end, bool apply) {
+            while (pos < end) {
+                while (run + 1 < this->m_runStart.size() && this->m_runStart[run + 1] <= pos)
+                    run++;
+
+                size_t run_end = (run + 1 < this->m_runStart.size()) ? this->m_runStart[run + 1] : size;
+                T value = apply ? op( this->m_runValue[run] ) : this->m_runValue[run];
+                if (run_value.empty() || !(run_value.back() == value)) {
+                    run_start.push_back( pos );
+                    run_value.push_back( value );
+                }
+                pos = std::min( run_end, end );
+            }
+        };
+
+        for (size_t box_run = 0; box_run < inputBox.numRuns(); box_run++) {
+            const size_t start = inputBox.runStart(box_run);
+            append_until( start, false );
+            append_until( start + inputBox.runLength(), true );
+        }
+        append_until( size, false );
+
+        run_start.shrink_to_fit();
+        run_value.shrink_to_fit();
+        this->m_runStart.swap( run_start );
+        this->m_runValue.swap( run_value );
+        if (this->m_runStart.size() * (sizeof(size_t) + sizeof(T)) >= size * sizeof(T))
+            this->pin();
+
+        return true;
+    }
+
+    template< typename T >
+    std::size_t GridProperty< T >::compress() {
+        if (!this->m_materialized.done)
+            return 0;
+
+        this->setRuns();
+        std::size_t dense_size = this->m_data.capacity() * sizeof(T);
+        std::size_t compact_size = this->m_runStart.size() * (sizeof(size_t) + sizeof(T));
+        if (compact_size >= dense_size) {
+            std::vector<size_t>().swap( this->m_runStart );
+            std::vector<T>().swap( this->m_runValue );
+            this->m_compact = false;
+            return 0;
+        }
+
+        std::vector<T>().swap( this->m_data );
+        this->m_materialized.done = false;
+        this->m_compact = true;
+        return dense_size - compact_size;
+    }
+
+    template< typename T >
+    bool GridProperty< T >::isCompact() const {
+        return this->m_compact && !this->m_materialized.done;
+    }
+
+    template< typename T >
+    bool GridProperty< T >::isRegenerable() const {
+        return this->m_regenerable;
+    }
+
+    template< typename T >
+    std::size_t GridProperty< T >::memoryUsage() const {
+        return this->m_data.capacity() * sizeof(T)
+            + this->m_runStart.capacity() * sizeof(size_t)
+            + this->m_runValue.capacity() * sizeof(T);
+    }
+
+    template< typename T >
+    std::size_t GridProperty< T >::release() {
+        if (!this->m_regenerable || !this->m_materialized.done)
+            return 0;
+
+        std::size_t bytes = this->memoryUsage();
+        this->setRuns();
+        this->m_compact = (this->m_runValue.size() == 1);
+        if (!this->m_compact) {
+            std::vector<size_t>().swap( this->m_runStart );
+            std::vector<T>().swap( this->m_runValue );
+        }
+
+        std::vector<T>().swap( this->m_data );
+        this->m_materialized.done = false;
+        return bytes - this->memoryUsage();
+    }
+
+    template< typename T >
+    void GridProperty< T >::touch() const {
+        this->m_lastAccess.value = ++access_clock;
+    }
+
+    template< typename T >
+    std::size_t GridProperty< T >::lastAccess() const {
+        return this->m_lastAccess.value;
     }
 
     template< typename T >
     void GridProperty< T >::checkLimits( T min, T max ) const {
+        this->materialize();
         for (size_t g=0; g < m_data.size(); g++) {
             T value = m_data[g];
             if ((value < min) || (value > max))
@@ -439,6 +687,7 @@ bool GridProperty<int>::containsNaN( ) const {
 
 template<>
 bool GridProperty<double>::containsNaN( ) const {
+    this->materialize();
     bool return_value = false;
     size_t size = m_data.size();
     size_t index = 0;
@@ -468,6 +717,7 @@ const std::string& GridProperty<double>::getDimensionString() const {
 
 template<typename T>
 std::vector<T> GridProperty<T>::compressedCopy(const EclipseGrid& grid) const {
+    this->materialize();
     if (grid.allActive())
         return m_data;
     else {
@@ -480,6 +730,15 @@ std::vector<T> GridProperty<T>::compressedCopy(const EclipseGrid& grid) const {
 template<typename T>
 std::vector<size_t> GridProperty<T>::cellsEqual(T value, const std::vector<int>& activeMap) const {
     std::vector<size_t> cells;
+    if (!this->m_materialized.done && this->m_compact) {
+        for (size_t active_index = 0; active_index < activeMap.size(); active_index++) {
+            if (this->m_runValue[ this->runIndex( activeMap[ active_index ] ) ] == value)
+                cells.push_back( active_index );
+        }
+        return cells;
+    }
+
+    this->materialize();
     for (size_t active_index = 0; active_index < activeMap.size(); active_index++) {
         size_t global_index = activeMap[ active_index ];
         if (m_data[global_index] == value)
@@ -491,6 +750,19 @@ std::vector<size_t> GridProperty<T>::cellsEqual(T value, const std::vector<int>&
 
 template<typename T>
 std::vector<size_t> GridProperty<T>::indexEqual(T value) const {
+    if (!this->m_materialized.done && this->m_compact) {
+        std::vector<size_t> index_list;
+        for (size_t run = 0; run < this->m_runStart.size(); run++) {
+            if (this->m_runValue[run] == value) {
+                size_t end = (run + 1 < this->m_runStart.size()) ? this->m_runStart[run + 1] : getCartesianSize();
+                for (size_t index = this->m_runStart[run]; index < end; index++)
+                    index_list.push_back( index );
+            }
+        }
+        return index_list;
+    }
+
+    this->materialize();
     std::vector<size_t> index_list;
     for (size_t index = 0; index < m_data.size(); index++) {
         if (m_data[index] == value)
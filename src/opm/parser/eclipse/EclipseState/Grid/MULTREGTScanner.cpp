@@ -19,6 +19,7 @@
 #include <stdexcept>
 #include <map>
 #include <set>
+#include <unordered_map>
 
 #include <opm/parser/eclipse/Deck/DeckItem.hpp>
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
@@ -98,8 +99,7 @@ namespace Opm {
       interface with the wanted region values.
     */
     MULTREGTScanner::MULTREGTScanner(const Eclipse3DProperties& e3DProps,
-                                     const std::vector< const DeckKeyword* >& keywords) :
-                m_e3DProps(e3DProps) {
+                                     const std::vector< const DeckKeyword* >& keywords) {
 
         for (size_t idx = 0; idx < keywords.size(); idx++)
             this->addKeyword(e3DProps, *keywords[idx] , e3DProps.getDefaultRegionKeyword());
@@ -135,6 +135,52 @@ namespace Opm {
 
             m_searchMap[keyword][pair] = record;
         }
+
+        this->compileSearchMap(e3DProps);
+    }
+
+
+    /*
+      The search map is compiled to one RegionTable for each region keyword,
+      so that getRegionMultiplier() only needs array lookups. The region
+      values are copied out of the grid properties when the tables are
+      built.
+    */
+    void MULTREGTScanner::compileSearchMap(const Eclipse3DProperties& props) {
+        for (const auto& search_pair : m_searchMap) {
+            const auto& region = props.getIntGridProperty( search_pair.first );
+            const auto& region_data = region.getData();
+            const auto& searchMap = search_pair.second;
+
+            std::unordered_map<int,int> region_number;
+            for (const auto& map_pair : searchMap) {
+                region_number.emplace( map_pair.first.first , 0 );
+                region_number.emplace( map_pair.first.second , 0 );
+            }
+
+            int num_regions = 0;
+            for (auto& region_pair : region_number)
+                region_pair.second = num_regions++;
+
+            RegionTable table;
+            table.num_regions = num_regions;
+            table.record_index.assign( num_regions * num_regions , -1 );
+            for (const auto& map_pair : searchMap) {
+                const int region1 = region_number.at( map_pair.first.first );
+                const int region2 = region_number.at( map_pair.first.second );
+                table.record_index[ region1 * num_regions + region2 ] = static_cast<int>( map_pair.second - m_records.data() );
+            }
+
+            table.cell_region.resize( region_data.size() );
+            for (size_t globalIndex = 0; globalIndex < region_data.size(); globalIndex++) {
+                const auto iter = region_number.find( region_data[globalIndex] );
+                table.cell_region[globalIndex] = (iter == region_number.end()) ? -1 : iter->second;
+            }
+
+            m_nx = region.getNX();
+            m_ny = region.getNY();
+            m_regionTables.push_back( std::move(table) );
+        }
     }
 
 
@@ -221,42 +267,73 @@ namespace Opm {
     */
     double MULTREGTScanner::getRegionMultiplier(size_t globalIndex1 , size_t globalIndex2, FaceDir::DirEnum faceDir) const {
 
-        for (auto iter = m_searchMap.begin(); iter != m_searchMap.end(); iter++) {
-            const Opm::GridProperty<int>& region = m_e3DProps.getIntGridProperty( (*iter).first );
-            const MULTREGTSearchMap& map = (*iter).second;
+        for (const auto& table : m_regionTables) {
+            int regionId1 = table.cell_region[globalIndex1];
+            int regionId2 = table.cell_region[globalIndex2];
+            if (regionId1 < 0 || regionId2 < 0)
+                continue;
 
-            int regionId1 = region.iget(globalIndex1);
-            int regionId2 = region.iget(globalIndex2);
+            /*
+              The records are added for both (region1, region2) and (region2,
+              region1), i.e. the table is symmetric.
+            */
+            int record_index = table.record_index[ regionId1 * table.num_regions + regionId2 ];
+            if (record_index < 0)
+                continue;
 
-            std::pair<int,int> pair{ regionId1, regionId2 };
-            if (map.count(pair) != 1 || !(map.at(pair)->directions & faceDir)) {
-                pair = std::pair<int,int>{regionId2 , regionId1};
-                if (map.count(pair) != 1 || !(map.at(pair)->directions & faceDir))
-                    continue;
-            }
-            const MULTREGTRecord* record = map.at(pair);
+            const MULTREGTRecord& record = m_records[record_index];
+            if (!(record.directions & faceDir))
+                continue;
 
             bool applyMultiplier = true;
-            int i1 = globalIndex1 % region.getNX();
-            int i2 = globalIndex2 % region.getNX();
-            int j1 = globalIndex1 / region.getNX() % region.getNY();
-            int j2 = globalIndex2 / region.getNX() % region.getNY();
+            int i1 = globalIndex1 % m_nx;
+            int i2 = globalIndex2 % m_nx;
+            int j1 = globalIndex1 / m_nx % m_ny;
+            int j2 = globalIndex2 / m_nx % m_ny;
 
-            if (record->nnc_behaviour == MULTREGT::NNC){
+            if (record.nnc_behaviour == MULTREGT::NNC){
                 applyMultiplier = true;
                 if ((std::abs(i1-i2) == 0 && std::abs(j1-j2) == 1) || (std::abs(i1-i2) == 1 && std::abs(j1-j2) == 0))
                     applyMultiplier = false;
             }
-            else if (record->nnc_behaviour == MULTREGT::NONNC){
+            else if (record.nnc_behaviour == MULTREGT::NONNC){
                 applyMultiplier = false;
                 if ((std::abs(i1-i2) == 0 && std::abs(j1-j2) == 1) || (std::abs(i1-i2) == 1 && std::abs(j1-j2) == 0))
                     applyMultiplier = true;
             }
 
             if (applyMultiplier)
-                return record->trans_mult;
+                return record.trans_mult;
 
         }
         return 1;
     }
+
+
+    bool MULTREGTScanner::hasRegionMultipliers() const {
+        return !m_regionTables.empty();
+    }
+
+
+    /*
+      Will evaluate the region multiplier for all the cell pairs
+      (globalCellIdx1[i], globalCellIdx2[i]) with the same face direction.
+    */
+    std::vector<double> MULTREGTScanner::getRegionMultipliers(const std::vector<size_t>& globalCellIdx1,
+                                                              const std::vector<size_t>& globalCellIdx2,
+                                                              FaceDir::DirEnum faceDir) const {
+        if (globalCellIdx1.size() != globalCellIdx2.size())
+            throw std::invalid_argument("The cell index arrays must have equal size");
+
+        const long size = globalCellIdx1.size();
+        std::vector<double> multipliers( size , 1.0 );
+        if (m_regionTables.empty())
+            return multipliers;
+
+#pragma omp parallel for if (size > 10000)
+        for (long index = 0; index < size; index++)
+            multipliers[index] = this->getRegionMultiplier( globalCellIdx1[index] , globalCellIdx2[index] , faceDir );
+
+        return multipliers;
+    }
 }
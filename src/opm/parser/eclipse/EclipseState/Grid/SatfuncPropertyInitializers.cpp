@@ -16,6 +16,11 @@
 
 
 #include <array>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
 
 #include <opm/parser/eclipse/EclipseState/Eclipse3DProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
@@ -80,17 +85,61 @@ namespace Opm {
 
     enum class limit { min, max };
 
+    static const size_t min_parallel_size = 10000;
+
+    /*
+      The endpoints are read straight from the packed column buffers of
+      the tables.
+    */
+    struct PackedColumn {
+        const double* data;
+        size_t size;
+
+        const double* begin() const { return data; }
+        const double* end() const { return data + size; }
+        double front() const { return data[0]; }
+        double back() const { return data[size - 1]; }
+        double operator[](size_t index) const { return data[index]; }
+    };
+
+    /*
+      All the tables of a family share the same schema, so the column is
+      resolved by name once, in the first table; this is also where a
+      JFUNC deck is rejected when the PCOW or PCOG columns are asked for.
+      Nothing is resolved for an empty container, which is only an error
+      if a column is actually read from it.
+    */
+    class PackedColumns {
+    public:
+        PackedColumns( const TableContainer& tables, const std::string& columnName ) :
+            m_tables( tables ),
+            m_columnIndex( tables.empty() ? 0 : tables.getTable( 0 ).getColumnIndex( columnName ) )
+        {}
+
+        PackedColumn operator()( size_t tableNumber ) const {
+            const auto packed = m_tables.getPackedTable( tableNumber );
+            return { packed.column( m_columnIndex ), packed.numRows };
+        }
+
+    private:
+        const TableContainer& m_tables;
+        size_t m_columnIndex;
+    };
+
     static std::vector< double > findMinWaterSaturation( const TableManager* tm ) {
         const auto num_tables = tm->getTabdims().getNumSatTables();
         const auto& swofTables = tm->getSwofTables();
         const auto& swfnTables = tm->getSwfnTables();
 
-        const auto famI = [&swofTables]( int i ) {
-            return swofTables.getTable< SwofTable >( i ).getSwColumn().front();
+        const PackedColumns swofSw( swofTables, "SW" );
+        const PackedColumns swfnSw( swfnTables, "SW" );
+
+        const auto famI = [&swofSw]( int i ) {
+            return swofSw( i ).front();
         };
 
-        const auto famII = [&swfnTables]( int i ) {
-            return swfnTables.getTable< SwfnTable >( i ).getSwColumn().front();
+        const auto famII = [&swfnSw]( int i ) {
+            return swfnSw( i ).front();
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -106,12 +155,15 @@ namespace Opm {
         const auto& swofTables = tm->getSwofTables();
         const auto& swfnTables = tm->getSwfnTables();
 
-        const auto famI = [&swofTables]( int i ) {
-            return swofTables.getTable< SwofTable >( i ).getSwColumn().back();
+        const PackedColumns swofSw( swofTables, "SW" );
+        const PackedColumns swfnSw( swfnTables, "SW" );
+
+        const auto famI = [&swofSw]( int i ) {
+            return swofSw( i ).back();
         };
 
-        const auto famII = [&swfnTables]( int i ) {
-            return swfnTables.getTable< SwfnTable >( i ).getSwColumn().back();
+        const auto famII = [&swfnSw]( int i ) {
+            return swfnSw( i ).back();
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -128,16 +180,20 @@ namespace Opm {
         const auto& slgofTables = tm->getSlgofTables();
         const auto& sgfnTables = tm->getSgfnTables();
 
-        const auto famI_sgof = [&sgofTables]( int i ) {
-            return sgofTables.getTable< SgofTable >( i ).getSgColumn().front();
+        const PackedColumns sgofSg( sgofTables, "SG" );
+        const PackedColumns slgofSl( slgofTables, "SL" );
+        const PackedColumns sgfnSg( sgfnTables, "SG" );
+
+        const auto famI_sgof = [&sgofSg]( int i ) {
+            return sgofSg( i ).front();
         };
 
-        const auto famI_slgof = [&slgofTables]( int i ) {
-            return 1.0 - slgofTables.getTable< SlgofTable >( i ).getSlColumn().back();
+        const auto famI_slgof = [&slgofSl]( int i ) {
+            return 1.0 - slgofSl( i ).back();
         };
 
-        const auto famII = [&sgfnTables]( int i ) {
-            return sgfnTables.getTable< SgfnTable >( i ).getSgColumn().front();
+        const auto famII = [&sgfnSg]( int i ) {
+            return sgfnSg( i ).front();
         };
 
 
@@ -168,16 +224,20 @@ namespace Opm {
         const auto& slgofTables = tm->getSlgofTables();
         const auto& sgfnTables = tm->getSgfnTables();
 
-        const auto famI_sgof = [&sgofTables]( int i ) {
-            return sgofTables.getTable< SgofTable >( i ).getSgColumn().back();
+        const PackedColumns sgofSg( sgofTables, "SG" );
+        const PackedColumns slgofSl( slgofTables, "SL" );
+        const PackedColumns sgfnSg( sgfnTables, "SG" );
+
+        const auto famI_sgof = [&sgofSg]( int i ) {
+            return sgofSg( i ).back();
         };
 
-        const auto famI_slgof = [&slgofTables]( int i ) {
-            return 1.0 - slgofTables.getTable< SlgofTable >( i ).getSlColumn().front();
+        const auto famI_slgof = [&slgofSl]( int i ) {
+            return 1.0 - slgofSl( i ).front();
         };
 
-        const auto famII = [&sgfnTables]( int i ) {
-            return sgfnTables.getTable< SgfnTable >( i ).getSgColumn().back();
+        const auto famII = [&sgfnSg]( int i ) {
+            return sgfnSg( i ).back();
         };
 
 
@@ -216,17 +276,17 @@ namespace Opm {
      *
      */
 
-    template< typename T >
-    static inline double critical_water( const T& table ) {
+    static inline double critical_water( const PackedColumns& krw,
+                                         const PackedColumns& sw,
+                                         size_t tableNumber ) {
 
-        const auto& col = table.getKrwColumn();
-        const auto end = col.begin() + table.numRows();
-        const auto critical = std::upper_bound( col.begin(), end, 0.0 );
+        const auto col = krw( tableNumber );
+        const auto critical = std::upper_bound( col.begin(), col.end(), 0.0 );
         const auto index = std::distance( col.begin(), critical );
 
-        if( index == 0 || critical == end ) return 0.0;
+        if( index == 0 || critical == col.end() ) return 0.0;
 
-        return table.getSwColumn()[ index - 1 ];
+        return sw( tableNumber )[ index - 1 ];
     }
 
     static std::vector< double > findCriticalWater( const TableManager* tm ) {
@@ -235,12 +295,15 @@ namespace Opm {
         const auto& swofTables = tm->getSwofTables();
         const auto& swfnTables = tm->getSwfnTables();
 
-        const auto famI = [&swofTables]( int i ) {
-            return critical_water( swofTables.getTable< SwofTable >( i ) );
+        const PackedColumns swofKrw( swofTables, "KRW" ), swofSw( swofTables, "SW" );
+        const PackedColumns swfnKrw( swfnTables, "KRW" ), swfnSw( swfnTables, "SW" );
+
+        const auto famI = [&swofKrw, &swofSw]( int i ) {
+            return critical_water( swofKrw, swofSw, i );
         };
 
-        const auto famII = [&swfnTables]( int i ) {
-            return critical_water( swfnTables.getTable< SwfnTable >( i ) );
+        const auto famII = [&swfnKrw, &swfnSw]( int i ) {
+            return critical_water( swfnKrw, swfnSw, i );
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -250,26 +313,20 @@ namespace Opm {
         }
     }
 
-    template< typename T >
-    static inline double critical_gas( const T& table ) {
-        const auto& col = table.getKrgColumn();
-        const auto end = col.begin() + table.numRows();
-        const auto critical = std::upper_bound( col.begin(), end, 0.0 );
-        const auto index = std::distance( col.begin(), critical );
-
-        if( index == 0 || critical == end ) return 0.0;
-
-        return table.getSgColumn()[ index - 1 ];
-    }
-
-    static inline double critical_gas( const SlgofTable& slgofTable ) {
-        const auto& col = slgofTable.getKrgColumn();
+    /*
+      The first column is SG for the SGOF and SGFN tables and SL for the
+      SLGOF tables.
+    */
+    static inline double critical_gas( const PackedColumns& krg,
+                                       const PackedColumns& sat,
+                                       size_t tableNumber ) {
+        const auto col = krg( tableNumber );
         const auto critical = std::upper_bound( col.begin(), col.end(), 0.0 );
         const auto index = std::distance( col.begin(), critical );
 
         if( index == 0 || critical == col.end() ) return 0.0;
 
-        return slgofTable.getSlColumn()[ index - 1 ];
+        return sat( tableNumber )[ index - 1 ];
     }
 
     static std::vector< double > findCriticalGas( const TableManager* tm ) {
@@ -279,16 +336,20 @@ namespace Opm {
         const auto& sgofTables = tm->getSgofTables();
         const auto& slgofTables = tm->getSlgofTables();
 
-        const auto famI_sgof = [&sgofTables]( int i ) {
-            return critical_gas( sgofTables.getTable< SgofTable >( i ) );
+        const PackedColumns sgofKrg( sgofTables, "KRG" ), sgofSg( sgofTables, "SG" );
+        const PackedColumns slgofKrg( slgofTables, "KRG" ), slgofSl( slgofTables, "SL" );
+        const PackedColumns sgfnKrg( sgfnTables, "KRG" ), sgfnSg( sgfnTables, "SG" );
+
+        const auto famI_sgof = [&sgofKrg, &sgofSg]( int i ) {
+            return critical_gas( sgofKrg, sgofSg, i );
         };
 
-        const auto famI_slgof = [&slgofTables]( int i ) {
-            return critical_gas( slgofTables.getTable< SlgofTable >( i ) );
+        const auto famI_slgof = [&slgofKrg, &slgofSl]( int i ) {
+            return critical_gas( slgofKrg, slgofSl, i );
         };
 
-        const auto famII = [&sgfnTables]( int i ) {
-            return critical_gas( sgfnTables.getTable< SgfnTable >( i ) );
+        const auto famII = [&sgfnKrg, &sgfnSg]( int i ) {
+            return critical_gas( sgfnKrg, sgfnSg, i );
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -425,12 +486,14 @@ namespace Opm {
         const auto& sgofTables = tm->getSgofTables();
         const auto& sgfnTables = tm->getSgfnTables();
 
-        const auto& famI = [&sgofTables]( int i ) {
-            return sgofTables.getTable< SgofTable >( i ).getKrgColumn().back();
+        const PackedColumns sgofKrg( sgofTables, "KRG" );
+        const auto& famI = [&sgofKrg]( int i ) {
+            return sgofKrg( i ).back();
         };
 
-        const auto& famII = [&sgfnTables]( int i ) {
-            return sgfnTables.getTable< SgfnTable >( i ).getKrgColumn().back();
+        const PackedColumns sgfnKrg( sgfnTables, "KRG" );
+        const auto& famII = [&sgfnKrg]( int i ) {
+            return sgfnKrg( i ).back();
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -448,12 +511,14 @@ namespace Opm {
         const auto& sgofTables = tm->getSgofTables();
         const auto& sgfnTables = tm->getSgfnTables();
 
-        const auto& famI = [&sgofTables]( int i ) {
-            return sgofTables.getTable< SgofTable >( i ).getKrgColumn().front();
+        const PackedColumns sgofKrg( sgofTables, "KRG" );
+        const auto& famI = [&sgofKrg]( int i ) {
+            return sgofKrg( i ).front();
         };
 
-        const auto& famII = [&sgfnTables]( int i ) {
-            return sgfnTables.getTable< SgfnTable >( i ).getKrgColumn().back();
+        const PackedColumns sgfnKrg( sgfnTables, "KRG" );
+        const auto& famII = [&sgfnKrg]( int i ) {
+            return sgfnKrg( i ).back();
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -471,12 +536,14 @@ namespace Opm {
         const auto& swofTables = tm->getSwofTables();
         const auto& swfnTables = tm->getSwfnTables();
 
-        const auto& famI = [&swofTables]( int i ) {
-            return swofTables.getTable< SwofTable >( i ).getKrwColumn().front();
+        const PackedColumns swofKrw( swofTables, "KRW" );
+        const auto& famI = [&swofKrw]( int i ) {
+            return swofKrw( i ).front();
         };
 
-        const auto& famII = [&swfnTables]( int i ) {
-            return swfnTables.getTable< SwfnTable >( i ).getKrwColumn().front();
+        const PackedColumns swfnKrw( swfnTables, "KRW" );
+        const auto& famII = [&swfnKrw]( int i ) {
+            return swfnKrw( i ).front();
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -571,12 +638,14 @@ namespace Opm {
         const auto& sgofTables = tm->getSgofTables();
         const auto& sgfnTables = tm->getSgfnTables();
 
-        const auto& famI = [&sgofTables]( int i ) {
-            return sgofTables.getTable< SgofTable >( i ).getPcogColumn().front();
+        const PackedColumns sgofPcog( sgofTables, "PCOG" );
+        const auto& famI = [&sgofPcog]( int i ) {
+            return sgofPcog( i ).front();
         };
 
-        const auto& famII = [&sgfnTables]( int i ) {
-            return sgfnTables.getTable< SgfnTable >( i ).getPcogColumn().back();
+        const PackedColumns sgfnPcog( sgfnTables, "PCOG" );
+        const auto& famII = [&sgfnPcog]( int i ) {
+            return sgfnPcog( i ).back();
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -594,12 +663,14 @@ namespace Opm {
         const auto& swofTables = tm->getSwofTables();
         const auto& swfnTables = tm->getSwfnTables();
 
-        const auto& famI = [&swofTables]( int i ) {
-            return swofTables.getTable< SwofTable >( i ).getPcowColumn().front();
+        const PackedColumns swofPcow( swofTables, "PCOW" );
+        const auto& famI = [&swofPcow]( int i ) {
+            return swofPcow( i ).front();
         };
 
-        const auto& famII = [&swfnTables]( int i ) {
-            return swfnTables.getTable< SwfnTable >( i ).getPcowColumn().front();
+        const PackedColumns swfnPcow( swfnTables, "PCOW" );
+        const auto& famII = [&swfnPcow]( int i ) {
+            return swfnPcow( i ).front();
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -617,12 +688,14 @@ namespace Opm {
         const auto& swofTables = tm->getSwofTables();
         const auto& sof3Tables = tm->getSof3Tables();
 
-        const auto& famI = [&swofTables]( int i ) {
-            return swofTables.getTable< SwofTable >( i ).getKrowColumn().front();
+        const PackedColumns swofKrow( swofTables, "KROW" );
+        const auto& famI = [&swofKrow]( int i ) {
+            return swofKrow( i ).front();
         };
 
-        const auto& famII = [&sof3Tables]( int i ) {
-            return sof3Tables.getTable< Sof3Table >( i ).getKrowColumn().back();
+        const PackedColumns sof3Krow( sof3Tables, "KROW" );
+        const auto& famII = [&sof3Krow]( int i ) {
+            return sof3Krow( i ).back();
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -640,12 +713,14 @@ namespace Opm {
         const auto& swofTables = tm->getSwofTables();
         const auto& swfnTables = tm->getSwfnTables();
 
-        const auto& famI = [&swofTables]( int i ) {
-            return swofTables.getTable< SwofTable >( i ).getKrwColumn().back();
+        const PackedColumns swofKrw( swofTables, "KRW" );
+        const auto& famI = [&swofKrw]( int i ) {
+            return swofKrw( i ).back();
         };
 
-        const auto& famII = [&swfnTables]( int i ) {
-            return swfnTables.getTable< SwfnTable >( i ).getKrwColumn().back();
+        const PackedColumns swfnKrw( swfnTables, "KRW" );
+        const auto& famII = [&swfnKrw]( int i ) {
+            return swfnKrw( i ).back();
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -658,123 +733,362 @@ namespace Opm {
         }
     }
 
-    static double selectValue( const TableContainer& depthTables,
-                               int tableIdx,
-                               const std::string& columnName,
-                               double cellDepth,
-                               double fallbackValue,
-                               bool useOneMinusTableValue) {
-
-        if( tableIdx < 0 ) return fallbackValue;
+    /*
+      The endpoint keywords: the depth table column, the function giving
+      the value for each saturation table, whether the keyword uses the
+      IMBNUM and IMPTVD tables instead of SATNUM and ENPTVD, and whether
+      the depth table gives one minus the value.
+    */
+    typedef std::vector< double > (*EndpointTableValues)( const TableManager* );
+
+    struct EndpointKeyword {
+        const char* keyword;
+        const char* column;
+        EndpointTableValues tableValues;
+        bool imbibition;
+        bool oneMinus;
+    };
+
+    static const EndpointKeyword endpointKeywords[] = {
+        { "SGL",    "SGCO",    findMinGasSaturation,   false, false },
+        { "ISGL",   "SGCO",    findMinGasSaturation,   true,  false },
+        { "SGU",    "SGMAX",   findMaxGasSaturation,   false, false },
+        { "ISGU",   "SGMAX",   findMaxGasSaturation,   true,  false },
+        { "SWL",    "SWCO",    findMinWaterSaturation, false, false },
+        { "ISWL",   "SWCO",    findMinWaterSaturation, true,  false },
+        { "SWU",    "SWMAX",   findMaxWaterSaturation, false, true  },
+        { "ISWU",   "SWMAX",   findMaxWaterSaturation, true,  true  },
+        { "SGCR",   "SGCRIT",  findCriticalGas,        false, false },
+        { "ISGCR",  "SGCRIT",  findCriticalGas,        true,  false },
+        { "SOWCR",  "SOWCRIT", findCriticalOilWater,   false, false },
+        { "ISOWCR", "SOWCRIT", findCriticalOilWater,   true,  false },
+        { "SOGCR",  "SOGCRIT", findCriticalOilGas,     false, false },
+        { "ISOGCR", "SOGCRIT", findCriticalOilGas,     true,  false },
+        { "SWCR",   "SWCRIT",  findCriticalWater,      false, false },
+        { "ISWCR",  "SWCRIT",  findCriticalWater,      true,  false },
+        { "PCW",    "PCW",     findMaxPcow,            false, false },
+        { "IPCW",   "IPCW",    findMaxPcow,            true,  false },
+        { "PCG",    "PCG",     findMaxPcog,            false, false },
+        { "IPCG",   "IPCG",    findMaxPcog,            true,  false },
+        { "KRW",    "KRW",     findMaxKrw,             false, false },
+        { "IKRW",   "IKRW",    findKrwr,               true,  false },
+        { "KRWR",   "KRWR",    findKrwr,               false, false },
+        { "IKRWR",  "IKRWR",   findKrwr,               true,  false },
+        { "KRO",    "KRO",     findMaxKro,             false, false },
+        { "IKRO",   "IKRO",    findMaxKro,             true,  false },
+        { "KRORW",  "KRORW",   findKrorw,              false, false },
+        { "IKRORW", "IKRORW",  findKrorw,              true,  false },
+        { "KRORG",  "KRORG",   findKrorg,              false, false },
+        { "IKRORG", "IKRORG",  findKrorg,              true,  false },
+        { "KRG",    "KRG",     findMaxKrg,             false, false },
+        { "IKRG",   "IKRG",    findMaxKrg,             true,  false },
+        { "KRGR",   "KRGR",    findKrgr,               false, false },
+        { "IKRGR",  "IKRGR",   findKrgr,               true,  false },
+    };
+
+    static const EndpointKeyword& findEndpointKeyword( const std::string& keyword ) {
+        for( const auto& endpoint : endpointKeywords )
+            if( keyword == endpoint.keyword ) return endpoint;
+
+        throw std::invalid_argument("Keyword " + keyword + " is not a saturation function endpoint");
+    }
 
-        const auto& table = depthTables.getTable( tableIdx );
+    /*
+      The table number of each cell, zero based, checked against the
+      number of saturation tables.
+    */
+    static std::vector< int > satfuncTableIndex( const std::string& keyword,
+                                                 size_t gridsize,
+                                                 int numSatTables,
+                                                 const GridProperties<int>* intGridProperties ) {
+        const auto& property = intGridProperties->getKeyword( keyword );
+        property.checkLimits( 1 , numSatTables );
+
+        std::vector< int > tableIdx( gridsize );
+        for( size_t cellIdx = 0; cellIdx < gridsize; cellIdx++ )
+            tableIdx[ cellIdx ] = property.iget( cellIdx ) - 1;
+
+        return tableIdx;
+    }
 
-        if( tableIdx >= int( depthTables.size() ) )
-            throw std::invalid_argument("Not enough tables!");
+    /*
+      Overwrites the endpoints of the cells with an ENDNUM region with the
+      values from the ENPTVD or IMPTVD tables, evaluated at the cell depth.
+      The cells are grouped by ENDNUM and the depths of each group are
+      evaluated in one call; a fully defaulted column evaluates to NaN and
+      leaves the values from the saturation tables in place.
+    */
+    static void applyDepthTables( const std::vector< const EndpointKeyword* >& endpoints,
+                                  const std::vector< size_t >& endpointIndex,
+                                  const TableContainer& depthTables,
+                                  const std::vector< double >& cellDepth,
+                                  const GridProperties<int>* intGridProperties,
+                                  std::vector< std::vector< double > >& values ) {
+        if( endpointIndex.empty() ) return;
 
-        // evaluate the table at the cell depth
-        const double value = table.evaluate( columnName, cellDepth );
+        const auto& endnum = intGridProperties->getKeyword("ENDNUM");
+        const auto gridsize = cellDepth.size();
 
-        // a column can be fully defaulted. In this case, eval() returns a NaN
-        // and we have to use the data from saturation tables
-        if( !std::isfinite( value ) ) return fallbackValue;
-        if( useOneMinusTableValue ) return 1 - value;
-        return value;
-    }
+        std::vector< size_t > regionStart( depthTables.size() + 1, 0 );
+        std::vector< int > region( gridsize );
+        for( size_t cellIdx = 0; cellIdx < gridsize; cellIdx++ ) {
+            region[ cellIdx ] = endnum.iget( cellIdx ) - 1;
+            if( region[ cellIdx ] < 0 ) continue;
+            if( region[ cellIdx ] >= int( depthTables.size() ) )
+                throw std::invalid_argument("Not enough tables!");
 
-    static std::vector< double > satnumApply( size_t size,
-                                              const std::string& columnName,
-                                              const std::vector< double >& fallbackValues,
-                                              const TableManager* tableManager,
-                                              const EclipseGrid* eclipseGrid,
-                                              const GridProperties<int>* intGridProperties,
-                                              bool useOneMinusTableValue ) {
+            regionStart[ region[ cellIdx ] + 1 ]++;
+        }
 
+        for( size_t r = 0; r < depthTables.size(); r++ )
+            regionStart[ r + 1 ] += regionStart[ r ];
 
-        std::vector< double > values( size, 0 );
-        auto tabdims = tableManager->getTabdims();
+        std::vector< size_t > cells( regionStart.back() );
+        {
+            auto next = regionStart;
+            for( size_t cellIdx = 0; cellIdx < gridsize; cellIdx++ )
+                if( region[ cellIdx ] >= 0 )
+                    cells[ next[ region[ cellIdx ] ]++ ] = cellIdx;
+        }
 
-        const auto& satnum = intGridProperties->getKeyword("SATNUM");
-        const auto& endnum = intGridProperties->getKeyword("ENDNUM");
-        int numSatTables = tabdims.getNumSatTables();
+        std::vector< double > depth( cells.size() );
+        for( size_t i = 0; i < cells.size(); i++ )
+            depth[ i ] = cellDepth[ cells[ i ] ];
+
+        std::vector< double > tableValue( cells.size() );
+        for( size_t r = 0; r < depthTables.size(); r++ ) {
+            const size_t begin = regionStart[ r ];
+            const size_t count = regionStart[ r + 1 ] - begin;
+            if( count == 0 ) continue;
+
+            const auto& table = depthTables.getTable( r );
+            for( const auto e : endpointIndex ) {
+                const auto& endpoint = *endpoints[ e ];
+                table.evaluate( table.getColumnIndex( endpoint.column ),
+                                depth.data() + begin, tableValue.data() + begin, count );
+
+                auto& endpointValues = values[ e ];
+                for( size_t i = begin; i < begin + count; i++ ) {
+                    const double value = tableValue[ i ];
+                    if( !std::isfinite( value ) ) continue;
+                    endpointValues[ cells[ i ] ] = endpoint.oneMinus ? 1 - value : value;
+                }
+            }
+        }
+    }
 
-        satnum.checkLimits( 1 , numSatTables );
+    /*
+      The values of the endpoint functions for each saturation table;
+      keywords with the same table function, e.g. SWL and ISWL, share the
+      lookup.
+    */
+    typedef std::map< EndpointTableValues, std::vector< double > > EndpointTables;
+
+    static std::vector< std::vector< double > > evaluateEndpoints( const std::vector< const EndpointKeyword* >& endpoints,
+                                                                   const EndpointTables& tableValues,
+                                                                   size_t size,
+                                                                   const TableManager* tableManager,
+                                                                   const EclipseGrid* eclipseGrid,
+                                                                   const GridProperties<int>* intGridProperties )
+    {
+        const size_t numEndpoints = endpoints.size();
+        const int numSatTables = tableManager->getTabdims().getNumSatTables();
+
+        /* The endpoints of each saturation table, one row per table. */
+        std::vector< double > tableEndpoints( numSatTables * numEndpoints );
+        for( size_t e = 0; e < numEndpoints; e++ ) {
+            const auto& values = tableValues.at( endpoints[ e ]->tableValues );
+            for( int t = 0; t < numSatTables; t++ )
+                tableEndpoints[ t * numEndpoints + e ] = values[ t ];
+        }
 
-        // acctually assign the defaults. if the ENPVD keyword was specified in the deck,
-        // this currently cannot be done because we would need the Z-coordinate of the
-        // cell and we would need to know how the simulator wants to interpolate between
-        // sampling points. Both of these are outside the scope of opm-parser, so we just
-        // assign a NaN in this case...
-        const bool useEnptvd = tableManager->useEnptvd();
-        const auto& enptvdTables = tableManager->getEnptvdTables();
+        bool drainage = false;
+        bool imbibition = false;
+        std::vector< size_t > enptvdEndpoints;
+        std::vector< size_t > imptvdEndpoints;
+        for( size_t e = 0; e < numEndpoints; e++ ) {
+            if( endpoints[ e ]->imbibition ) {
+                imbibition = true;
+                if( tableManager->useImptvd() ) imptvdEndpoints.push_back( e );
+            } else {
+                drainage = true;
+                if( tableManager->useEnptvd() ) enptvdEndpoints.push_back( e );
+            }
+        }
 
         const auto gridsize = eclipseGrid->getCartesianSize();
-        for( size_t cellIdx = 0; cellIdx < gridsize; cellIdx++ ) {
-            int satTableIdx = satnum.iget( cellIdx ) - 1;
-            int endNum = endnum.iget( cellIdx ) - 1;
-            double cellDepth = eclipseGrid->getCellDepth( cellIdx );
-
+        const auto satnum = drainage
+            ? satfuncTableIndex( "SATNUM", gridsize, numSatTables, intGridProperties )
+            : std::vector< int >();
+        const auto imbnum = imbibition
+            ? satfuncTableIndex( "IMBNUM", gridsize, numSatTables, intGridProperties )
+            : std::vector< int >();
+
+        std::vector< std::vector< double > > values( numEndpoints, std::vector< double >( size, 0 ) );
+#pragma omp parallel for if (gridsize > min_parallel_size)
+        for( long cellIdx = 0; cellIdx < long( gridsize ); cellIdx++ ) {
+            const double* satRow = drainage ? &tableEndpoints[ satnum[ cellIdx ] * numEndpoints ] : nullptr;
+            const double* imbRow = imbibition ? &tableEndpoints[ imbnum[ cellIdx ] * numEndpoints ] : nullptr;
+            for( size_t e = 0; e < numEndpoints; e++ )
+                values[ e ][ cellIdx ] = endpoints[ e ]->imbibition ? imbRow[ e ] : satRow[ e ];
+        }
 
-            values[cellIdx] = selectValue(enptvdTables,
-                                        (useEnptvd && endNum >= 0) ? endNum : -1,
-                                        columnName,
-                                        cellDepth,
-                                        fallbackValues[ satTableIdx ],
-                                        useOneMinusTableValue);
+        if( !enptvdEndpoints.empty() || !imptvdEndpoints.empty() ) {
+            const auto depth = eclipseGrid->getCellDepths();
+            applyDepthTables( endpoints, enptvdEndpoints, tableManager->getEnptvdTables(),
+                              depth, intGridProperties, values );
+            applyDepthTables( endpoints, imptvdEndpoints, tableManager->getImptvdTables(),
+                              depth, intGridProperties, values );
         }
 
         return values;
     }
 
-    static std::vector< double > imbnumApply( size_t size,
-                                              const std::string& columnName,
-                                              const std::vector< double >& fallBackValues,
-                                              const TableManager* tableManager,
-                                              const EclipseGrid* eclipseGrid,
-                                              const GridProperties<int>* intGridProperties,
-                                              bool useOneMinusTableValue ) {
+    std::vector< std::vector< double > > satfuncEndpoints( const std::vector< std::string >& keywords,
+                                                           size_t size,
+                                                           const TableManager* tableManager,
+                                                           const EclipseGrid* eclipseGrid,
+                                                           const GridProperties<int>* intGridProperties )
+    {
+        std::vector< const EndpointKeyword* > endpoints;
+        for( const auto& keyword : keywords )
+            endpoints.push_back( &findEndpointKeyword( keyword ) );
+
+        EndpointTables tableValues;
+        for( const auto* endpoint : endpoints ) {
+            if( tableValues.count( endpoint->tableValues ) == 0 )
+                tableValues.emplace( endpoint->tableValues, endpoint->tableValues( tableManager ) );
+        }
 
-        std::vector< double > values( size, 0 );
+        return evaluateEndpoints( endpoints, tableValues, size, tableManager, eclipseGrid, intGridProperties );
+    }
 
-        const auto& imbnum = intGridProperties->getKeyword("IMBNUM");
-        const auto& endnum = intGridProperties->getKeyword("ENDNUM");
 
-        auto tabdims = tableManager->getTabdims();
-        const int numSatTables = tabdims.getNumSatTables();
-
-        imbnum.checkLimits( 1 , numSatTables );
-        // acctually assign the defaults. if the ENPVD keyword was specified in the deck,
-        // this currently cannot be done because we would need the Z-coordinate of the
-        // cell and we would need to know how the simulator wants to interpolate between
-        // sampling points. Both of these are outside the scope of opm-parser, so we just
-        // assign a NaN in this case...
-        const bool useImptvd = tableManager->useImptvd();
-        const TableContainer& imptvdTables = tableManager->getImptvdTables();
-        const auto gridsize = eclipseGrid->getCartesianSize();
-        for( size_t cellIdx = 0; cellIdx < gridsize; cellIdx++ ) {
-            int imbTableIdx = imbnum.iget( cellIdx ) - 1;
-            int endNum = endnum.iget( cellIdx ) - 1;
-            double cellDepth = eclipseGrid->getCellDepth( cellIdx );
-
-            values[cellIdx] = selectValue(imptvdTables,
-                                                (useImptvd && endNum >= 0) ? endNum : -1,
-                                                columnName,
-                                                cellDepth,
-                                                fallBackValues[imbTableIdx],
-                                                useOneMinusTableValue);
+    SatfuncEndpointCache::SatfuncEndpointCache( const TableManager* tableManager,
+                                                const EclipseGrid* eclipseGrid,
+                                                const GridProperties<int>* intGridProperties ) :
+        m_tableManager( tableManager ),
+        m_eclipseGrid( eclipseGrid ),
+        m_intGridProperties( intGridProperties )
+    {
+    }
+
+
+    static bool hasDepthColumn( const TableContainer& depthTables, const char* column ) {
+        for( size_t tableIdx = 0; tableIdx < depthTables.size(); tableIdx++ )
+            if( !depthTables.getTable( tableIdx ).hasColumn( column ) ) return false;
+
+        return true;
+    }
+
+    /*
+      The endpoint which initializes a grid property, e.g. SWL for SWLX-
+      and SWLPC, or nullptr if the property is not an endpoint property.
+    */
+    static const EndpointKeyword* propertyEndpoint( const std::string& property ) {
+        for( const auto& pc : { "SWLPC", "SGLPC", "ISWLPC", "ISGLPC" } )
+            if( property == pc ) return &findEndpointKeyword( property.substr( 0, property.size() - 2 ) );
+
+        /* Strip the direction suffix: X, X-, Y, Y-, Z or Z-. */
+        std::string keyword = property;
+        if( !keyword.empty() && keyword.back() == '-' ) keyword.pop_back();
+        if( !keyword.empty() && ( keyword.back() == 'X' || keyword.back() == 'Y' || keyword.back() == 'Z' ) )
+            keyword.pop_back();
+
+        for( const auto& endpoint : endpointKeywords )
+            if( keyword == endpoint.keyword ) return &endpoint;
+
+        return nullptr;
+    }
+
+
+    void SatfuncEndpointCache::request( const std::vector< std::string >& keywords ) {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        for( const auto& keyword : keywords ) {
+            const auto* endpoint = propertyEndpoint( keyword );
+            if( endpoint && m_values.count( endpoint->keyword ) == 0 )
+                m_requested.insert( endpoint->keyword );
+        }
+    }
+
+
+    /*
+      The requested keywords without a column in the depth table are left
+      out of the shared pass. They are computed on their own if they are
+      requested, and will then raise the appropriate error. Errors from
+      the saturation tables are raised right away. Called with the mutex
+      held.
+    */
+    void SatfuncEndpointCache::evaluateRequested( size_t size ) {
+        const bool enptvd = m_tableManager->useEnptvd();
+        const bool imptvd = m_tableManager->useImptvd();
+        std::vector< const EndpointKeyword* > endpoints;
+        EndpointTables tableValues;
+        for( const auto& keyword : m_requested ) {
+            const auto& endpoint = findEndpointKeyword( keyword );
+            if( endpoint.imbibition ? imptvd : enptvd ) {
+                const auto& depthTables = endpoint.imbibition ? m_tableManager->getImptvdTables()
+                                                              : m_tableManager->getEnptvdTables();
+                if( !hasDepthColumn( depthTables, endpoint.column ) ) continue;
+            }
+
+            if( tableValues.count( endpoint.tableValues ) == 0 )
+                tableValues.emplace( endpoint.tableValues, endpoint.tableValues( m_tableManager ) );
+
+            endpoints.push_back( &endpoint );
         }
 
+        auto values = evaluateEndpoints( endpoints, tableValues, size, m_tableManager, m_eclipseGrid, m_intGridProperties );
+        m_requested.clear();
+        m_numPasses++;
+        for( size_t e = 0; e < endpoints.size(); e++ )
+            m_values.emplace( endpoints[ e ]->keyword, std::move( values[ e ] ) );
+    }
+
+
+    /*
+      The grid properties may be materialized from several threads, the
+      mutex serializes the use of the cache; the shared pass is run once,
+      by the first thread which needs one of the requested keywords.
+    */
+    std::vector< double > SatfuncEndpointCache::get( const std::string& keyword, size_t size ) {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        if( m_requested.count( keyword ) > 0 )
+            evaluateRequested( size );
+
+        auto iter = m_values.find( keyword );
+        if( iter == m_values.end() || iter->second.size() != size ) {
+            auto values = satfuncEndpoints( { keyword }, size, m_tableManager, m_eclipseGrid, m_intGridProperties ).front();
+            m_numPasses++;
+            return values;
+        }
+
+        auto values = std::move( iter->second );
+        m_values.erase( iter );
         return values;
     }
 
+
+    size_t SatfuncEndpointCache::numPasses() const {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        return m_numPasses;
+    }
+
+
+    static std::vector< double > satfuncEndpoint( const std::string& keyword,
+                                                  size_t size,
+                                                  const TableManager* tableManager,
+                                                  const EclipseGrid* eclipseGrid,
+                                                  GridProperties<int>* intGridProperties ) {
+        return satfuncEndpoints( { keyword }, size, tableManager, eclipseGrid, intGridProperties ).front();
+    }
+
     std::vector< double > SGLEndpoint( size_t size,
                                        const TableManager * tableManager,
                                        const EclipseGrid* eclipseGrid,
                                        GridProperties<int>* intGridProperties )
     {
-        const auto min_gas = findMinGasSaturation( tableManager );
-        return satnumApply( size, "SGCO", min_gas, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "SGL", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > ISGLEndpoint( size_t size,
@@ -782,9 +1096,7 @@ namespace Opm {
                                         const EclipseGrid* eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto min_gas = findMinGasSaturation( tableManager );
-        return imbnumApply( size, "SGCO", min_gas, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "ISGL", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > SGUEndpoint( size_t size,
@@ -792,9 +1104,7 @@ namespace Opm {
                                        const EclipseGrid* eclipseGrid,
                                        GridProperties<int>* intGridProperties )
     {
-        const auto max_gas = findMaxGasSaturation( tableManager );
-        return satnumApply( size, "SGMAX", max_gas, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "SGU", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > ISGUEndpoint( size_t size,
@@ -802,9 +1112,7 @@ namespace Opm {
                                         const EclipseGrid* eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto max_gas = findMaxGasSaturation( tableManager );
-        return imbnumApply( size, "SGMAX", max_gas, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "ISGU", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > SWLEndpoint( size_t size,
@@ -812,9 +1120,7 @@ namespace Opm {
                                        const EclipseGrid* eclipseGrid,
                                        GridProperties<int>* intGridProperties )
     {
-        const auto min_water = findMinWaterSaturation( tableManager );
-        return satnumApply( size, "SWCO", min_water, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "SWL", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > ISWLEndpoint( size_t size,
@@ -822,9 +1128,7 @@ namespace Opm {
                                         const EclipseGrid  * eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto min_water = findMinWaterSaturation( tableManager );
-        return imbnumApply( size, "SWCO", min_water, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "ISWL", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > SWUEndpoint( size_t size,
@@ -832,9 +1136,7 @@ namespace Opm {
                                        const EclipseGrid  * eclipseGrid,
                                        GridProperties<int>* intGridProperties )
     {
-        const auto max_water = findMaxWaterSaturation( tableManager );
-        return satnumApply( size, "SWMAX", max_water, tableManager, eclipseGrid,
-                            intGridProperties, true );
+        return satfuncEndpoint( "SWU", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > ISWUEndpoint( size_t size,
@@ -842,9 +1144,7 @@ namespace Opm {
                                         const EclipseGrid  * eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto max_water = findMaxWaterSaturation( tableManager );
-        return imbnumApply( size, "SWMAX", max_water, tableManager, eclipseGrid,
-                            intGridProperties, true);
+        return satfuncEndpoint( "ISWU", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > SGCREndpoint( size_t size,
@@ -852,9 +1152,7 @@ namespace Opm {
                                         const EclipseGrid  * eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto crit_gas = findCriticalGas( tableManager );
-        return satnumApply( size, "SGCRIT", crit_gas, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "SGCR", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > ISGCREndpoint( size_t size,
@@ -862,9 +1160,7 @@ namespace Opm {
                                          const EclipseGrid  * eclipseGrid,
                                          GridProperties<int>* intGridProperties )
     {
-        const auto crit_gas = findCriticalGas( tableManager );
-        return imbnumApply( size, "SGCRIT", crit_gas, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "ISGCR", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > SOWCREndpoint( size_t size,
@@ -872,9 +1168,7 @@ namespace Opm {
                                          const EclipseGrid  * eclipseGrid,
                                          GridProperties<int>* intGridProperties )
     {
-        const auto oil_water = findCriticalOilWater( tableManager );
-        return satnumApply( size, "SOWCRIT", oil_water, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "SOWCR", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > ISOWCREndpoint( size_t size,
@@ -882,9 +1176,7 @@ namespace Opm {
                                           const EclipseGrid  * eclipseGrid,
                                           GridProperties<int>* intGridProperties )
     {
-        const auto oil_water = findCriticalOilWater( tableManager );
-        return imbnumApply( size, "SOWCRIT", oil_water, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "ISOWCR", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > SOGCREndpoint( size_t size,
@@ -892,9 +1184,7 @@ namespace Opm {
                                          const EclipseGrid  * eclipseGrid,
                                          GridProperties<int>* intGridProperties )
     {
-        const auto crit_oil_gas = findCriticalOilGas( tableManager );
-        return satnumApply( size, "SOGCRIT", crit_oil_gas, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "SOGCR", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > ISOGCREndpoint( size_t size,
@@ -902,9 +1192,7 @@ namespace Opm {
                                           const EclipseGrid  * eclipseGrid,
                                           GridProperties<int>* intGridProperties )
     {
-        const auto crit_oil_gas = findCriticalOilGas( tableManager );
-        return imbnumApply( size, "SOGCRIT", crit_oil_gas, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "ISOGCR", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > SWCREndpoint( size_t size,
@@ -912,9 +1200,7 @@ namespace Opm {
                                         const EclipseGrid  * eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto crit_water = findCriticalWater( tableManager );
-        return satnumApply( size, "SWCRIT", crit_water, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "SWCR", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > ISWCREndpoint( size_t size,
@@ -922,9 +1208,7 @@ namespace Opm {
                                          const EclipseGrid  * eclipseGrid,
                                          GridProperties<int>* intGridProperties )
     {
-        const auto crit_water = findCriticalWater( tableManager );
-        return imbnumApply( size, "SWCRIT", crit_water, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "ISWCR", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > PCWEndpoint( size_t size,
@@ -932,9 +1216,7 @@ namespace Opm {
                                        const EclipseGrid  * eclipseGrid,
                                        GridProperties<int>* intGridProperties )
     {
-        const auto max_pcow = findMaxPcow( tableManager );
-        return satnumApply( size, "PCW", max_pcow, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "PCW", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > IPCWEndpoint( size_t size,
@@ -942,9 +1224,7 @@ namespace Opm {
                                         const EclipseGrid  * eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto max_pcow = findMaxPcow( tableManager );
-        return imbnumApply( size, "IPCW", max_pcow, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "IPCW", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > PCGEndpoint( size_t size,
@@ -952,9 +1232,7 @@ namespace Opm {
                                        const EclipseGrid  * eclipseGrid,
                                        GridProperties<int>* intGridProperties )
     {
-        const auto max_pcog = findMaxPcog( tableManager );
-        return satnumApply( size, "PCG", max_pcog, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "PCG", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > IPCGEndpoint( size_t size,
@@ -962,9 +1240,7 @@ namespace Opm {
                                         const EclipseGrid  * eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto max_pcog = findMaxPcog( tableManager );
-        return imbnumApply( size, "IPCG", max_pcog, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "IPCG", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > KRWEndpoint( size_t size,
@@ -972,9 +1248,7 @@ namespace Opm {
                                        const EclipseGrid  * eclipseGrid,
                                        GridProperties<int>* intGridProperties )
     {
-        const auto max_krw = findMaxKrw( tableManager );
-        return satnumApply( size, "KRW", max_krw, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "KRW", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > IKRWEndpoint( size_t size,
@@ -982,9 +1256,7 @@ namespace Opm {
                                         const EclipseGrid  * eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto krwr = findKrwr( tableManager );
-        return imbnumApply( size, "IKRW", krwr, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "IKRW", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > KRWREndpoint( size_t size,
@@ -992,9 +1264,7 @@ namespace Opm {
                                         const EclipseGrid  * eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto krwr = findKrwr( tableManager );
-        return satnumApply( size, "KRWR", krwr, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "KRWR", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > IKRWREndpoint( size_t size,
@@ -1002,9 +1272,7 @@ namespace Opm {
                                          const EclipseGrid  * eclipseGrid,
                                          GridProperties<int>* intGridProperties )
     {
-        const auto krwr = findKrwr( tableManager );
-        return imbnumApply( size, "IKRWR", krwr, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "IKRWR", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > KROEndpoint( size_t size,
@@ -1012,9 +1280,7 @@ namespace Opm {
                                        const EclipseGrid  * eclipseGrid,
                                        GridProperties<int>* intGridProperties )
     {
-        const auto max_kro = findMaxKro( tableManager );
-        return satnumApply( size, "KRO", max_kro, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "KRO", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > IKROEndpoint( size_t size,
@@ -1022,9 +1288,7 @@ namespace Opm {
                                         const EclipseGrid  * eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto max_kro = findMaxKro( tableManager );
-        return imbnumApply( size, "IKRO", max_kro, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "IKRO", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > KRORWEndpoint( size_t size,
@@ -1032,9 +1296,7 @@ namespace Opm {
                                          const EclipseGrid  * eclipseGrid,
                                          GridProperties<int>* intGridProperties )
     {
-        const auto krorw = findKrorw( tableManager );
-        return satnumApply( size, "KRORW", krorw, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "KRORW", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > IKRORWEndpoint( size_t size,
@@ -1042,9 +1304,7 @@ namespace Opm {
                                           const EclipseGrid  * eclipseGrid,
                                           GridProperties<int>* intGridProperties )
     {
-        const auto krorw = findKrorw( tableManager );
-        return imbnumApply( size, "IKRORW", krorw, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "IKRORW", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > KRORGEndpoint( size_t size,
@@ -1052,9 +1312,7 @@ namespace Opm {
                                          const EclipseGrid  * eclipseGrid,
                                          GridProperties<int>* intGridProperties )
     {
-        const auto krorg = findKrorg( tableManager );
-        return satnumApply( size, "KRORG", krorg, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "KRORG", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > IKRORGEndpoint( size_t size,
@@ -1062,9 +1320,7 @@ namespace Opm {
                                           const EclipseGrid  * eclipseGrid,
                                           GridProperties<int>* intGridProperties )
     {
-        const auto krorg = findKrorg( tableManager );
-        return imbnumApply( size, "IKRORG", krorg, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "IKRORG", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > KRGEndpoint( size_t size,
@@ -1072,9 +1328,7 @@ namespace Opm {
                                        const EclipseGrid  * eclipseGrid,
                                        GridProperties<int>* intGridProperties )
     {
-        const auto max_krg = findMaxKrg( tableManager );
-        return satnumApply( size, "KRG", max_krg, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "KRG", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > IKRGEndpoint( size_t size,
@@ -1082,9 +1336,7 @@ namespace Opm {
                                         const EclipseGrid  * eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto max_krg = findMaxKrg( tableManager );
-        return imbnumApply( size, "IKRG", max_krg, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "IKRG", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > KRGREndpoint( size_t size,
@@ -1092,9 +1344,7 @@ namespace Opm {
                                         const EclipseGrid  * eclipseGrid,
                                         GridProperties<int>* intGridProperties )
     {
-        const auto krgr = findKrgr( tableManager );
-        return satnumApply( size, "KRGR", krgr, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "KRGR", size, tableManager, eclipseGrid, intGridProperties );
     }
 
     std::vector< double > IKRGREndpoint( size_t size,
@@ -1102,8 +1352,6 @@ namespace Opm {
                                          const EclipseGrid* eclipseGrid,
                                          GridProperties<int>* intGridProperties )
     {
-        const auto krgr = findKrgr( tableManager );
-        return imbnumApply( size, "IKRGR", krgr, tableManager, eclipseGrid,
-                            intGridProperties, false );
+        return satfuncEndpoint( "IKRGR", size, tableManager, eclipseGrid, intGridProperties );
     }
 }
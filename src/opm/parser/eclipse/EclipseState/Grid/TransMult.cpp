@@ -17,6 +17,8 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <iterator>
 #include <stdexcept>
 
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
@@ -84,6 +86,77 @@ namespace Opm {
         return m_multregtScanner.getRegionMultiplier(globalCellIndex1, globalCellIndex2, faceDir);
     }
 
+    std::vector<double> TransMult::getRegionMultipliers(const std::vector<size_t>& globalCellIndex1,
+                                                        const std::vector<size_t>& globalCellIndex2,
+                                                        FaceDir::DirEnum faceDir) const {
+        return m_multregtScanner.getRegionMultipliers(globalCellIndex1, globalCellIndex2, faceDir);
+    }
+
+    std::vector<double> TransMult::getMultipliers(FaceDir::DirEnum faceDir) const {
+        if (hasDirectionProperty( faceDir ))
+            return m_trans.at(faceDir).getData();
+        else
+            return std::vector<double>(m_nx * m_ny * m_nz, 1.0);
+    }
+
+
+    size_t TransMult::faceIndex(FaceDir::DirEnum faceDir) {
+        switch (faceDir) {
+        case FaceDir::XPlus:  return 0;
+        case FaceDir::XMinus: return 1;
+        case FaceDir::YPlus:  return 2;
+        case FaceDir::YMinus: return 3;
+        case FaceDir::ZPlus:  return 4;
+        case FaceDir::ZMinus: return 5;
+        default:
+            throw std::invalid_argument("Invalid face direction");
+        }
+    }
+
+
+    void TransMult::getFaceMultipliers(std::vector<double>& multipliers) const {
+        const FaceDir::DirEnum faceDirs[] = { FaceDir::XPlus, FaceDir::XMinus,
+                                              FaceDir::YPlus, FaceDir::YMinus,
+                                              FaceDir::ZPlus, FaceDir::ZMinus };
+        const size_t size = m_nx * m_ny * m_nz;
+        multipliers.resize(6 * size);
+
+        for (auto faceDir : faceDirs) {
+            auto dst = multipliers.begin() + faceIndex(faceDir) * size;
+            if (hasDirectionProperty( faceDir )) {
+                const auto& data = m_trans.at(faceDir).getData();
+                std::copy(data.begin(), data.end(), dst);
+            } else
+                std::fill(dst, dst + size, 1.0);
+        }
+
+        if (!m_multregtScanner.hasRegionMultipliers())
+            return;
+
+        /* The neighbour offset for the XPlus, YPlus and ZPlus directions. */
+        const size_t stride[3] = { 1, m_nx, m_nx * m_ny };
+        const size_t dims[3] = { m_nx, m_ny, m_nz };
+        for (int dim = 0; dim < 3; dim++) {
+            const auto faceDir = faceDirs[2*dim];
+            double * dst = multipliers.data() + faceIndex(faceDir) * size;
+
+#pragma omp parallel for if (size > 10000)
+            for (long g = 0; g < static_cast<long>(size); g++) {
+                const size_t ijk = (g / stride[dim]) % dims[dim];
+                if (ijk + 1 < dims[dim])
+                    dst[g] *= m_multregtScanner.getRegionMultiplier(g, g + stride[dim], faceDir);
+            }
+        }
+    }
+
+
+    std::vector<double> TransMult::getFaceMultipliers() const {
+        std::vector<double> multipliers;
+        this->getFaceMultipliers(multipliers);
+        return multipliers;
+    }
+
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
         return m_trans.count(faceDir) == 1;
     }
@@ -105,10 +178,7 @@ namespace Opm {
     void TransMult::applyMULT(const GridProperty<double>& srcProp, FaceDir::DirEnum faceDir)
     {
         auto& dstProp = getDirectionProperty(faceDir);
-
-        const std::vector<double> &srcData = srcProp.getData();
-        for (size_t i = 0; i < srcData.size(); ++i)
-            dstProp.multiplyValueAtIndex(i, srcData[i]);
+        dstProp.multiplyWith(srcProp);
     }
 
 
@@ -117,12 +187,19 @@ namespace Opm {
 
         for( const auto& face : fault ) {
             FaceDir::DirEnum faceDir = face.getDir();
-            auto& multProperty = getDirectionProperty(faceDir);
 
-
-            for( auto globalIndex : face ) {
-                multProperty.multiplyValueAtIndex( globalIndex , transMult);
-            }
+            /*
+              The cells of one face are distinct, so the multiplier can be
+              scattered in parallel. The getData() call will expand the
+              property before the loop is entered.
+            */
+            auto& multData = getDirectionProperty(faceDir).getData();
+            const auto indexList = face.begin();
+            const long size = std::distance(face.begin(), face.end());
+
+#pragma omp parallel for if (size > 10000)
+            for (long index = 0; index < size; index++)
+                multData[ indexList[index] ] *= transMult;
         }
     }
 
@@ -17,8 +17,9 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <fnmatch.h>
+#include <functional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <stdexcept>
 #include <iostream>
@@ -173,6 +174,25 @@ namespace Opm {
     }
 
 
+    /*
+      The HandlerContext bundles all the arguments which are passed along
+      to the individual keyword handlers; that way all the handlers can be
+      stored with the same signature in the keyword dispatch table.
+    */
+    struct Schedule::HandlerContext {
+        size_t& currentStep;
+        const SCHEDULESection& section;
+        size_t keywordIdx;
+        const DeckKeyword& keyword;
+        const ParseContext& parseContext;
+        ErrorGuard& errors;
+        const EclipseGrid& grid;
+        const Eclipse3DProperties& eclipseProperties;
+        const UnitSystem& unit_system;
+        std::vector<std::pair<const DeckKeyword*, size_t > >& rftProperties;
+    };
+
+
     void Schedule::handleKeyword(size_t& currentStep,
                                  const SCHEDULESection& section,
                                  size_t keywordIdx,
@@ -183,179 +203,115 @@ namespace Opm {
                                  const Eclipse3DProperties& eclipseProperties,
                                  const UnitSystem& unit_system,
                                  std::vector<std::pair<const DeckKeyword*, size_t > >& rftProperties) {
-    /*
-      geoModifiers is a list of geo modifiers which can be found in the schedule
-      section. This is only partly supported, support is indicated by the bool
-      value. The keywords which are supported will be assembled in a per-timestep
-      'minideck', whereas ParseContext::UNSUPPORTED_SCHEDULE_GEO_MODIFIER will be
-      consulted for the others.
-    */
-
-        const std::map<std::string,bool> geoModifiers = {{"MULTFLT"  , true},
-                                                         {"MULTPV"   , false},
-                                                         {"MULTX"    , false},
-                                                         {"MULTX-"   , false},
-                                                         {"MULTY"    , false},
-                                                         {"MULTY-"   , false},
-                                                         {"MULTZ"    , false},
-                                                         {"MULTZ-"   , false},
-                                                         {"MULTREGT" , false},
-                                                         {"MULTR"    , false},
-                                                         {"MULTR-"   , false},
-                                                         {"MULTSIG"  , false},
-                                                         {"MULTSIGV" , false},
-                                                         {"MULTTHT"  , false},
-                                                         {"MULTTHT-" , false}};
-
-        if (keyword.name() == "DATES") {
-            checkIfAllConnectionsIsShut(currentStep);
-            currentStep += keyword.size();
-        }
-
-        else if (keyword.name() == "TSTEP") {
-            checkIfAllConnectionsIsShut(currentStep);
-            currentStep += keyword.getRecord(0).getItem(0).size(); // This is a bit weird API.
-        }
-
-        else if (keyword.name() == "UDQ")
-            handleUDQ(keyword, currentStep);
-
-        else if (keyword.name() == "WLIST")
-            handleWLIST( keyword, currentStep );
-
-        else if (keyword.name() == "WELSPECS")
-            handleWELSPECS( section, keywordIdx, currentStep );
-
-        else if (keyword.name() == "WHISTCTL")
-            handleWHISTCTL(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WCONHIST")
-            handleWCONHIST(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WCONPROD")
-            handleWCONPROD(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WCONINJE")
-            handleWCONINJE(section, keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WPOLYMER")
-            handleWPOLYMER(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WSOLVENT")
-            handleWSOLVENT(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WTRACER")
-            handleWTRACER(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WTEST")
-            handleWTEST(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WTEMP")
-            handleWTEMP(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WPMITAB")
-            handleWPMITAB(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WSKPTAB")
-            handleWSKPTAB(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WINJTEMP")
-            handleWINJTEMP(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WCONINJH")
-            handleWCONINJH(section, keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WGRUPCON")
-            handleWGRUPCON(keyword, currentStep);
-
-        else if (keyword.name() == "COMPDAT")
-            handleCOMPDAT(keyword, currentStep, grid, eclipseProperties, parseContext, errors);
-
-        else if (keyword.name() == "WELSEGS")
-            handleWELSEGS(keyword, currentStep);
-
-        else if (keyword.name() == "COMPSEGS")
-            handleCOMPSEGS(keyword, currentStep, grid, parseContext, errors);
-
-        else if (keyword.name() == "WELOPEN")
-            handleWELOPEN(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "WELTARG")
-            handleWELTARG(section, keyword, currentStep, parseContext, errors);
 
-        else if (keyword.name() == "GRUPTREE")
-            handleGRUPTREE(keyword, currentStep);
+        using handler_function = std::function<void(Schedule&, HandlerContext&)>;
 
-        else if (keyword.name() == "GRUPNET")
-            handleGRUPNET(keyword, currentStep);
-
-        else if (keyword.name() == "GCONINJE")
-            handleGCONINJE(section, keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "GCONPROD")
-            handleGCONPROD(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "GEFAC")
-            handleGEFAC(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "TUNING")
-            handleTUNING(keyword, currentStep);
-
-        else if (keyword.name() == "WRFT")
-            rftProperties.push_back( std::make_pair( &keyword , currentStep ));
-
-        else if (keyword.name() == "WRFTPLT")
-            rftProperties.push_back( std::make_pair( &keyword , currentStep ));
-
-        else if (keyword.name() == "WPIMULT")
-            handleWPIMULT(keyword, currentStep);
-
-        else if (keyword.name() == "COMPORD")
-            handleCOMPORD(parseContext, errors , keyword, currentStep);
-
-        else if (keyword.name() == "COMPLUMP")
-            handleCOMPLUMP(keyword, currentStep);
-
-        else if (keyword.name() == "DRSDT")
-            handleDRSDT(keyword, currentStep);
-
-        else if (keyword.name() == "DRVDT")
-            handleDRVDT(keyword, currentStep);
-
-        else if (keyword.name() == "DRSDTR")
-            handleDRSDTR(keyword, currentStep);
-
-        else if (keyword.name() == "DRVDTR")
-            handleDRVDTR(keyword, currentStep);
-
-        else if (keyword.name() == "VAPPARS")
-            handleVAPPARS(keyword, currentStep);
-
-        else if (keyword.name() == "WECON")
-            handleWECON(keyword, currentStep, parseContext, errors);
-
-        else if (keyword.name() == "MESSAGES")
-            handleMESSAGES(keyword, currentStep);
+        /*
+          The dispatch table is assembled once, the keywords are then
+          dispatched to the correct handler with one hash lookup instead of
+          going through a long chain of string comparisons for every keyword
+          in the SCHEDULE section.
+        */
+        static const std::unordered_map<std::string, handler_function> handler_functions = []() {
+            std::unordered_map<std::string, handler_function> handlers = {
+                {"DATES", [](Schedule& schedule, HandlerContext& ctx) {
+                        schedule.checkIfAllConnectionsIsShut(ctx.currentStep);
+                        ctx.currentStep += ctx.keyword.size();
+                    }},
+                {"TSTEP", [](Schedule& schedule, HandlerContext& ctx) {
+                        schedule.checkIfAllConnectionsIsShut(ctx.currentStep);
+                        ctx.currentStep += ctx.keyword.getRecord(0).getItem(0).size(); // This is a bit weird API.
+                    }},
+                {"UDQ",      [](Schedule& s, HandlerContext& ctx) { s.handleUDQ(ctx.keyword, ctx.currentStep); }},
+                {"WLIST",    [](Schedule& s, HandlerContext& ctx) { s.handleWLIST(ctx.keyword, ctx.currentStep); }},
+                {"WELSPECS", [](Schedule& s, HandlerContext& ctx) { s.handleWELSPECS(ctx.section, ctx.keywordIdx, ctx.currentStep); }},
+                {"WHISTCTL", [](Schedule& s, HandlerContext& ctx) { s.handleWHISTCTL(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WCONHIST", [](Schedule& s, HandlerContext& ctx) { s.handleWCONHIST(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WCONPROD", [](Schedule& s, HandlerContext& ctx) { s.handleWCONPROD(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WCONINJE", [](Schedule& s, HandlerContext& ctx) { s.handleWCONINJE(ctx.section, ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WPOLYMER", [](Schedule& s, HandlerContext& ctx) { s.handleWPOLYMER(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WSOLVENT", [](Schedule& s, HandlerContext& ctx) { s.handleWSOLVENT(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WTRACER",  [](Schedule& s, HandlerContext& ctx) { s.handleWTRACER(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WTEST",    [](Schedule& s, HandlerContext& ctx) { s.handleWTEST(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WTEMP",    [](Schedule& s, HandlerContext& ctx) { s.handleWTEMP(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WPMITAB",  [](Schedule& s, HandlerContext& ctx) { s.handleWPMITAB(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WSKPTAB",  [](Schedule& s, HandlerContext& ctx) { s.handleWSKPTAB(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WINJTEMP", [](Schedule& s, HandlerContext& ctx) { s.handleWINJTEMP(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WCONINJH", [](Schedule& s, HandlerContext& ctx) { s.handleWCONINJH(ctx.section, ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WGRUPCON", [](Schedule& s, HandlerContext& ctx) { s.handleWGRUPCON(ctx.keyword, ctx.currentStep); }},
+                {"COMPDAT",  [](Schedule& s, HandlerContext& ctx) { s.handleCOMPDAT(ctx.keyword, ctx.currentStep, ctx.grid, ctx.eclipseProperties, ctx.parseContext, ctx.errors); }},
+                {"WELSEGS",  [](Schedule& s, HandlerContext& ctx) { s.handleWELSEGS(ctx.keyword, ctx.currentStep); }},
+                {"COMPSEGS", [](Schedule& s, HandlerContext& ctx) { s.handleCOMPSEGS(ctx.keyword, ctx.currentStep, ctx.grid, ctx.parseContext, ctx.errors); }},
+                {"WELOPEN",  [](Schedule& s, HandlerContext& ctx) { s.handleWELOPEN(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"WELTARG",  [](Schedule& s, HandlerContext& ctx) { s.handleWELTARG(ctx.section, ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"GRUPTREE", [](Schedule& s, HandlerContext& ctx) { s.handleGRUPTREE(ctx.keyword, ctx.currentStep); }},
+                {"GRUPNET",  [](Schedule& s, HandlerContext& ctx) { s.handleGRUPNET(ctx.keyword, ctx.currentStep); }},
+                {"GCONINJE", [](Schedule& s, HandlerContext& ctx) { s.handleGCONINJE(ctx.section, ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"GCONPROD", [](Schedule& s, HandlerContext& ctx) { s.handleGCONPROD(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"GEFAC",    [](Schedule& s, HandlerContext& ctx) { s.handleGEFAC(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"TUNING",   [](Schedule& s, HandlerContext& ctx) { s.handleTUNING(ctx.keyword, ctx.currentStep); }},
+                {"WRFT",     [](Schedule&  , HandlerContext& ctx) { ctx.rftProperties.push_back( std::make_pair( &ctx.keyword , ctx.currentStep )); }},
+                {"WRFTPLT",  [](Schedule&  , HandlerContext& ctx) { ctx.rftProperties.push_back( std::make_pair( &ctx.keyword , ctx.currentStep )); }},
+                {"WPIMULT",  [](Schedule& s, HandlerContext& ctx) { s.handleWPIMULT(ctx.keyword, ctx.currentStep); }},
+                {"COMPORD",  [](Schedule& s, HandlerContext& ctx) { s.handleCOMPORD(ctx.parseContext, ctx.errors , ctx.keyword, ctx.currentStep); }},
+                {"COMPLUMP", [](Schedule& s, HandlerContext& ctx) { s.handleCOMPLUMP(ctx.keyword, ctx.currentStep); }},
+                {"DRSDT",    [](Schedule& s, HandlerContext& ctx) { s.handleDRSDT(ctx.keyword, ctx.currentStep); }},
+                {"DRVDT",    [](Schedule& s, HandlerContext& ctx) { s.handleDRVDT(ctx.keyword, ctx.currentStep); }},
+                {"DRSDTR",   [](Schedule& s, HandlerContext& ctx) { s.handleDRSDTR(ctx.keyword, ctx.currentStep); }},
+                {"DRVDTR",   [](Schedule& s, HandlerContext& ctx) { s.handleDRVDTR(ctx.keyword, ctx.currentStep); }},
+                {"VAPPARS",  [](Schedule& s, HandlerContext& ctx) { s.handleVAPPARS(ctx.keyword, ctx.currentStep); }},
+                {"WECON",    [](Schedule& s, HandlerContext& ctx) { s.handleWECON(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"MESSAGES", [](Schedule& s, HandlerContext& ctx) { s.handleMESSAGES(ctx.keyword, ctx.currentStep); }},
+                {"WEFAC",    [](Schedule& s, HandlerContext& ctx) { s.handleWEFAC(ctx.keyword, ctx.currentStep, ctx.parseContext, ctx.errors); }},
+                {"VFPINJ",   [](Schedule& s, HandlerContext& ctx) { s.handleVFPINJ(ctx.keyword, ctx.unit_system, ctx.currentStep); }},
+                {"VFPPROD",  [](Schedule& s, HandlerContext& ctx) { s.handleVFPPROD(ctx.keyword, ctx.unit_system, ctx.currentStep); }}
+            };
 
-        else if (keyword.name() == "WEFAC")
-            handleWEFAC(keyword, currentStep, parseContext, errors);
+            /*
+              geoModifiers is a list of geo modifiers which can be found in the schedule
+              section. This is only partly supported, support is indicated by the bool
+              value. The keywords which are supported will be assembled in a per-timestep
+              'minideck', whereas ParseContext::UNSUPPORTED_SCHEDULE_GEO_MODIFIER will be
+              consulted for the others.
+            */
+            const std::map<std::string,bool> geoModifiers = {{"MULTFLT"  , true},
+                                                             {"MULTPV"   , false},
+                                                             {"MULTX"    , false},
+                                                             {"MULTX-"   , false},
+                                                             {"MULTY"    , false},
+                                                             {"MULTY-"   , false},
+                                                             {"MULTZ"    , false},
+                                                             {"MULTZ-"   , false},
+                                                             {"MULTREGT" , false},
+                                                             {"MULTR"    , false},
+                                                             {"MULTR-"   , false},
+                                                             {"MULTSIG"  , false},
+                                                             {"MULTSIGV" , false},
+                                                             {"MULTTHT"  , false},
+                                                             {"MULTTHT-" , false}};
+
+            for (const auto& geo_pair : geoModifiers) {
+                if (geo_pair.second)
+                    handlers.emplace(geo_pair.first, [](Schedule& schedule, HandlerContext& ctx) {
+                            schedule.m_modifierDeck[ ctx.currentStep ].addKeyword( ctx.keyword );
+                            schedule.m_events.addEvent( ScheduleEvents::GEO_MODIFIER , ctx.currentStep);
+                        });
+                else
+                    handlers.emplace(geo_pair.first, [](Schedule& , HandlerContext& ctx) {
+                            std::string msg = "OPM does not support grid property modifier " + ctx.keyword.name() + " in the Schedule section. Error at report: " + std::to_string( ctx.currentStep );
+                            ctx.parseContext.handleError( ParseContext::UNSUPPORTED_SCHEDULE_GEO_MODIFIER , msg, ctx.errors );
+                        });
+            }
 
-        else if (keyword.name() == "VFPINJ")
-            handleVFPINJ(keyword, unit_system, currentStep);
+            return handlers;
+        }();
 
-        else if (keyword.name() == "VFPPROD")
-            handleVFPPROD(keyword, unit_system, currentStep);
+        auto handler_iter = handler_functions.find(keyword.name());
+        if (handler_iter == handler_functions.end())
+            return;
 
-        else if (geoModifiers.find( keyword.name() ) != geoModifiers.end()) {
-            bool supported = geoModifiers.at( keyword.name() );
-            if (supported) {
-                this->m_modifierDeck[ currentStep ].addKeyword( keyword );
-                m_events.addEvent( ScheduleEvents::GEO_MODIFIER , currentStep);
-            } else {
-                std::string msg = "OPM does not support grid property modifier " + keyword.name() + " in the Schedule section. Error at report: " + std::to_string( currentStep );
-                parseContext.handleError( ParseContext::UNSUPPORTED_SCHEDULE_GEO_MODIFIER , msg, errors );
-            }
-        }
+        HandlerContext ctx{currentStep, section, keywordIdx, keyword, parseContext, errors, grid, eclipseProperties, unit_system, rftProperties};
+        handler_iter->second(*this, ctx);
     }
 
 
@@ -1825,6 +1781,7 @@ namespace Opm {
         }
         {
             wells_static.insert( std::make_pair(wellName, DynamicState<std::shared_ptr<Well2>>(m_timeMap, nullptr)));
+            this->well_matcher.addWell(wellName);
 
             auto& dynamic_state = wells_static.at(wellName);
             const std::string& group = record.getItem<ParserKeywords::WELSPECS::GROUP>().getTrimmedString(0);
@@ -1974,32 +1931,22 @@ namespace Opm {
                 return {};
         }
 
-        // Normal pattern matching
-        auto star_pos = pattern.find('*');
-        if (star_pos != std::string::npos) {
-            int flags = 0;
-            std::vector<std::string> names;
-            for (const auto& well_pair : this->wells_static) {
-                if (fnmatch(pattern.c_str(), well_pair.first.c_str(), flags) == 0) {
-                    const auto& dynamic_state = well_pair.second;
-                    if (dynamic_state.get(timeStep))
-                        names.push_back(well_pair.first);
-                }
-            }
-            return names;
-        }
-
         // ACTIONX handler
         if (pattern == "?")
             return { matching_wells.begin(), matching_wells.end() };
 
-        // Normal well name without any special characters
-        if (this->hasWell(pattern)) {
-            const auto& dynamic_state = this->wells_static.at(pattern);
+        /*
+          Normal pattern matching and normal well names without any special
+          characters; the well matcher will use a hash lookup for plain well
+          names and cache the result of previous pattern matches.
+        */
+        for (auto well_index : this->well_matcher.match(pattern)) {
+            const auto& well_pair = *std::next(this->wells_static.begin(), well_index);
+            const auto& dynamic_state = well_pair.second;
             if (dynamic_state.get(timeStep))
-                return { pattern };
+                names.push_back(well_pair.first);
         }
-        return {};
+        return names;
     }
 
     std::vector<std::string> Schedule::wellNames(const std::string& pattern) const {
@@ -0,0 +1,483 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/VFPEvaluator.hpp>
+
+namespace Opm {
+
+namespace {
+
+const long min_parallel_size = 1000;
+
+
+/*
+  Multilinear interpolation in the cell with the lower corner at data[0];
+  the upper corner in dimension d is step[d] further out. The corners
+  are reduced one dimension at a time, starting with the innermost, and
+  the derivatives of the dimensions already reduced are interpolated
+  along.
+*/
+template <std::size_t ndim>
+double interpolate(const double* data, const std::size_t* step, const double* factor,
+                   const double* inv_width, double* derivative) {
+    const std::size_t num_corners = std::size_t(1) << ndim;
+    double value[num_corners];
+    double deriv[ndim][num_corners];
+
+    for (std::size_t c = 0; c < num_corners; c++) {
+        std::size_t offset = 0;
+        for (std::size_t d = 0; d < ndim; d++) {
+            if (c & (std::size_t(1) << (ndim - 1 - d)))
+                offset += step[d];
+        }
+        value[c] = data[offset];
+    }
+
+    std::size_t count = num_corners;
+    for (std::size_t d = ndim; d-- > 0;) {
+        const double f = factor[d];
+        count /= 2;
+        for (std::size_t m = 0; m < count; m++) {
+            const double a = value[2*m];
+            const double b = value[2*m + 1];
+            for (std::size_t e = d + 1; e < ndim; e++)
+                deriv[e][m] = (1 - f) * deriv[e][2*m] + f * deriv[e][2*m + 1];
+
+            value[m] = (1 - f) * a + f * b;
+            deriv[d][m] = (b - a) * inv_width[d];
+        }
+    }
+
+    for (std::size_t d = 0; d < ndim; d++)
+        derivative[d] = deriv[d][0];
+
+    return value[0];
+}
+
+
+/*
+  The value of num / den, and the derivatives with respect to num and
+  den; all zero if den is zero.
+*/
+void ratio(double num, double den, double& value, double& dnum, double& dden) {
+    if (den == 0) {
+        value = 0;
+        dnum = 0;
+        dden = 0;
+        return;
+    }
+
+    value = num / den;
+    dnum = 1 / den;
+    dden = -value / den;
+}
+
+
+/*
+  Finds the thp where the bhp, as a piecewise linear function through
+  the points (thp[j], bhp_values[j]), equals bhp. The first interval
+  containing bhp is used, if there is none the end interval closest to
+  bhp is extrapolated. The rate derivatives of the bhp values are
+  carried over to the thp.
+*/
+VFPEvaluation findTHP(const std::vector<double>& thp, const std::vector<VFPEvaluation>& bhp_values, double bhp) {
+    VFPEvaluation result;
+    const std::size_t size = thp.size();
+    if (size == 1) {
+        result.value = thp[0];
+        return result;
+    }
+
+    std::size_t i = size;
+    for (std::size_t j = 0; j + 1 < size; j++) {
+        const double b0 = bhp_values[j].value;
+        const double b1 = bhp_values[j + 1].value;
+        if (std::min(b0, b1) <= bhp && bhp <= std::max(b0, b1)) {
+            i = j;
+            break;
+        }
+    }
+    if (i == size) {
+        if (std::fabs(bhp - bhp_values[0].value) <= std::fabs(bhp - bhp_values[size - 1].value))
+            i = 0;
+        else
+            i = size - 2;
+    }
+
+    const VFPEvaluation& lower = bhp_values[i];
+    const VFPEvaluation& upper = bhp_values[i + 1];
+    const double dbhp = upper.value - lower.value;
+    if (dbhp == 0) {
+        result.value = thp[i];
+        return result;
+    }
+
+    const double t = (bhp - lower.value) / dbhp;
+    const double dthp = (thp[i + 1] - thp[i]) / dbhp;
+    result.value = thp[i] + t * (thp[i + 1] - thp[i]);
+    result.dpressure = dthp;
+    result.dwat = -dthp * ((1 - t) * lower.dwat + t * upper.dwat);
+    result.doil = -dthp * ((1 - t) * lower.doil + t * upper.doil);
+    result.dgas = -dthp * ((1 - t) * lower.dgas + t * upper.dgas);
+    return result;
+}
+
+}
+
+
+VFPAxis::VFPAxis(const std::vector<double>& values) :
+    m_values(values)
+{
+    if (values.empty())
+        throw std::invalid_argument("A VFP table axis can not be empty");
+
+    for (std::size_t i = 0; i + 1 < values.size(); i++) {
+        const double width = values[i + 1] - values[i];
+        if (!(width > 0))
+            throw std::invalid_argument("The values of a VFP table axis must be strictly increasing");
+
+        m_inv_width.push_back(1 / width);
+    }
+}
+
+
+std::size_t VFPAxis::size() const {
+    return m_values.size();
+}
+
+
+void VFPAxis::find(double value, std::size_t& index, double& factor, double& inv_width) const {
+    if (m_values.size() < 2) {
+        index = 0;
+        factor = 0;
+        inv_width = 0;
+        return;
+    }
+
+    const auto upper = std::upper_bound(m_values.begin() + 1, m_values.end() - 1, value);
+    index = (upper - m_values.begin()) - 1;
+    inv_width = m_inv_width[index];
+    factor = (value - m_values[index]) * inv_width;
+}
+
+
+VFPProdEvaluator::VFPProdEvaluator(const VFPProdTable& table) :
+    m_flo_type(table.getFloType()),
+    m_wfr_type(table.getWFRType()),
+    m_gfr_type(table.getGFRType()),
+    m_thp_axis(table.getTHPAxis()),
+    m_wfr_axis(table.getWFRAxis()),
+    m_gfr_axis(table.getGFRAxis()),
+    m_alq_axis(table.getALQAxis()),
+    m_flo_axis(table.getFloAxis()),
+    m_thp_values(table.getTHPAxis())
+{
+    if (m_flo_type == VFPProdTable::FLO_INVALID || m_wfr_type == VFPProdTable::WFR_INVALID || m_gfr_type == VFPProdTable::GFR_INVALID)
+        throw std::invalid_argument("Can not evaluate VFPPROD table " + std::to_string(table.getTableNum()) + " with invalid rate types");
+
+    const VFPAxis* axes[5] = {&m_thp_axis, &m_wfr_axis, &m_gfr_axis, &m_alq_axis, &m_flo_axis};
+    std::size_t stride = 1;
+    for (std::size_t d = 5; d-- > 0;) {
+        m_stride[d] = stride;
+        m_step[d] = (axes[d]->size() > 1) ? stride : 0;
+        stride *= axes[d]->size();
+    }
+
+    const auto& data = table.getTable();
+    if (data.num_elements() != stride)
+        throw std::invalid_argument("Size mismatch for the data of VFPPROD table " + std::to_string(table.getTableNum()));
+
+    m_data.assign(data.data(), data.data() + data.num_elements());
+}
+
+
+VFPProdEvaluator::Coordinates VFPProdEvaluator::coordinates(double wat, double oil, double gas, double alq) const {
+    Coordinates coord;
+    double value[4];
+    std::fill(coord.dwat, coord.dwat + 4, 0.0);
+    std::fill(coord.doil, coord.doil + 4, 0.0);
+    std::fill(coord.dgas, coord.dgas + 4, 0.0);
+
+    double dnum, dden;
+    switch (m_wfr_type) {
+    case VFPProdTable::WFR_WOR:
+        ratio(wat, oil, value[0], dnum, dden);
+        coord.dwat[0] = dnum;
+        coord.doil[0] = dden;
+        break;
+    case VFPProdTable::WFR_WCT:
+        ratio(wat, wat + oil, value[0], dnum, dden);
+        coord.dwat[0] = dnum + dden;
+        coord.doil[0] = dden;
+        break;
+    default:
+        ratio(wat, gas, value[0], dnum, dden);
+        coord.dwat[0] = dnum;
+        coord.dgas[0] = dden;
+    }
+
+    switch (m_gfr_type) {
+    case VFPProdTable::GFR_GOR:
+        ratio(gas, oil, value[1], dnum, dden);
+        coord.dgas[1] = dnum;
+        coord.doil[1] = dden;
+        break;
+    case VFPProdTable::GFR_GLR:
+        ratio(gas, wat + oil, value[1], dnum, dden);
+        coord.dgas[1] = dnum;
+        coord.dwat[1] = dden;
+        coord.doil[1] = dden;
+        break;
+    default:
+        ratio(oil, gas, value[1], dnum, dden);
+        coord.doil[1] = dnum;
+        coord.dgas[1] = dden;
+    }
+
+    value[2] = alq;
+
+    switch (m_flo_type) {
+    case VFPProdTable::FLO_OIL:
+        value[3] = oil;
+        coord.doil[3] = 1;
+        break;
+    case VFPProdTable::FLO_LIQ:
+        value[3] = wat + oil;
+        coord.dwat[3] = 1;
+        coord.doil[3] = 1;
+        break;
+    default:
+        value[3] = gas;
+        coord.dgas[3] = 1;
+    }
+
+    const VFPAxis* axes[4] = {&m_wfr_axis, &m_gfr_axis, &m_alq_axis, &m_flo_axis};
+    coord.offset = 0;
+    for (std::size_t d = 0; d < 4; d++) {
+        std::size_t index;
+        axes[d]->find(value[d], index, coord.factor[d], coord.inv_width[d]);
+        coord.offset += index * m_stride[d + 1];
+    }
+
+    return coord;
+}
+
+
+VFPEvaluation VFPProdEvaluator::rateDerivatives(const Coordinates& coord, double value, const double* derivative) const {
+    VFPEvaluation result;
+    result.value = value;
+    for (std::size_t d = 0; d < 4; d++) {
+        result.dwat += derivative[d] * coord.dwat[d];
+        result.doil += derivative[d] * coord.doil[d];
+        result.dgas += derivative[d] * coord.dgas[d];
+    }
+    return result;
+}
+
+
+VFPEvaluation VFPProdEvaluator::bhp(const Coordinates& coord, double thp) const {
+    std::size_t thp_index;
+    double factor[5], inv_width[5], derivative[5];
+    m_thp_axis.find(thp, thp_index, factor[0], inv_width[0]);
+    std::copy(coord.factor, coord.factor + 4, factor + 1);
+    std::copy(coord.inv_width, coord.inv_width + 4, inv_width + 1);
+
+    const double* data = m_data.data() + coord.offset + thp_index * m_stride[0];
+    const double value = interpolate<5>(data, m_step, factor, inv_width, derivative);
+
+    VFPEvaluation result = this->rateDerivatives(coord, value, derivative + 1);
+    result.dpressure = derivative[0];
+    return result;
+}
+
+
+VFPEvaluation VFPProdEvaluator::thp(const Coordinates& coord, double bhp, std::vector<VFPEvaluation>& bhp_values) const {
+    bhp_values.resize(m_thp_values.size());
+    for (std::size_t j = 0; j < m_thp_values.size(); j++) {
+        double derivative[4];
+        const double* data = m_data.data() + coord.offset + j * m_stride[0];
+        const double value = interpolate<4>(data, m_step + 1, coord.factor, coord.inv_width, derivative);
+        bhp_values[j] = this->rateDerivatives(coord, value, derivative);
+    }
+
+    return findTHP(m_thp_values, bhp_values, bhp);
+}
+
+
+VFPEvaluation VFPProdEvaluator::bhp(double wat, double oil, double gas, double thp, double alq) const {
+    return this->bhp(this->coordinates(wat, oil, gas, alq), thp);
+}
+
+
+VFPEvaluation VFPProdEvaluator::thp(double wat, double oil, double gas, double bhp, double alq) const {
+    std::vector<VFPEvaluation> bhp_values;
+    return this->thp(this->coordinates(wat, oil, gas, alq), bhp, bhp_values);
+}
+
+
+void VFPProdEvaluator::bhp(std::size_t num_wells, const double* wat, const double* oil, const double* gas,
+                           const double* thp, const double* alq, VFPEvaluation* result) const {
+    const long size = static_cast<long>(num_wells);
+
+#pragma omp parallel for if (size > min_parallel_size)
+    for (long w = 0; w < size; w++)
+        result[w] = this->bhp(this->coordinates(wat[w], oil[w], gas[w], alq[w]), thp[w]);
+}
+
+
+void VFPProdEvaluator::thp(std::size_t num_wells, const double* wat, const double* oil, const double* gas,
+                           const double* bhp, const double* alq, VFPEvaluation* result) const {
+    const long size = static_cast<long>(num_wells);
+
+#pragma omp parallel if (size > min_parallel_size)
+    {
+        std::vector<VFPEvaluation> bhp_values(m_thp_values.size());
+
+#pragma omp for
+        for (long w = 0; w < size; w++)
+            result[w] = this->thp(this->coordinates(wat[w], oil[w], gas[w], alq[w]), bhp[w], bhp_values);
+    }
+}
+
+
+VFPInjEvaluator::VFPInjEvaluator(const VFPInjTable& table) :
+    m_flo_type(table.getFloType()),
+    m_thp_axis(table.getTHPAxis()),
+    m_flo_axis(table.getFloAxis()),
+    m_thp_values(table.getTHPAxis())
+{
+    if (m_flo_type == VFPInjTable::FLO_INVALID)
+        throw std::invalid_argument("Can not evaluate VFPINJ table " + std::to_string(table.getTableNum()) + " with invalid rate type");
+
+    m_stride[0] = m_flo_axis.size();
+    m_stride[1] = 1;
+    m_step[0] = (m_thp_axis.size() > 1) ? m_stride[0] : 0;
+    m_step[1] = (m_flo_axis.size() > 1) ? m_stride[1] : 0;
+
+    const auto& data = table.getTable();
+    if (data.num_elements() != m_thp_axis.size() * m_flo_axis.size())
+        throw std::invalid_argument("Size mismatch for the data of VFPINJ table " + std::to_string(table.getTableNum()));
+
+    m_data.assign(data.data(), data.data() + data.num_elements());
+}
+
+
+VFPInjEvaluator::Coordinates VFPInjEvaluator::coordinates(double wat, double oil, double gas) const {
+    Coordinates coord;
+    coord.dwat = 0;
+    coord.doil = 0;
+    coord.dgas = 0;
+
+    double flo;
+    switch (m_flo_type) {
+    case VFPInjTable::FLO_OIL:
+        flo = oil;
+        coord.doil = 1;
+        break;
+    case VFPInjTable::FLO_WAT:
+        flo = wat;
+        coord.dwat = 1;
+        break;
+    default:
+        flo = gas;
+        coord.dgas = 1;
+    }
+
+    m_flo_axis.find(flo, coord.offset, coord.factor, coord.inv_width);
+    return coord;
+}
+
+
+VFPEvaluation VFPInjEvaluator::bhp(const Coordinates& coord, double thp) const {
+    std::size_t thp_index;
+    double factor[2], inv_width[2], derivative[2];
+    m_thp_axis.find(thp, thp_index, factor[0], inv_width[0]);
+    factor[1] = coord.factor;
+    inv_width[1] = coord.inv_width;
+
+    const double* data = m_data.data() + coord.offset + thp_index * m_stride[0];
+
+    VFPEvaluation result;
+    result.value = interpolate<2>(data, m_step, factor, inv_width, derivative);
+    result.dpressure = derivative[0];
+    result.dwat = derivative[1] * coord.dwat;
+    result.doil = derivative[1] * coord.doil;
+    result.dgas = derivative[1] * coord.dgas;
+    return result;
+}
+
+
+VFPEvaluation VFPInjEvaluator::thp(const Coordinates& coord, double bhp, std::vector<VFPEvaluation>& bhp_values) const {
+    bhp_values.resize(m_thp_values.size());
+    for (std::size_t j = 0; j < m_thp_values.size(); j++) {
+        double derivative;
+        const double* data = m_data.data() + coord.offset + j * m_stride[0];
+
+        VFPEvaluation& value = bhp_values[j];
+        value.value = interpolate<1>(data, m_step + 1, &coord.factor, &coord.inv_width, &derivative);
+        value.dwat = derivative * coord.dwat;
+        value.doil = derivative * coord.doil;
+        value.dgas = derivative * coord.dgas;
+    }
+
+    return findTHP(m_thp_values, bhp_values, bhp);
+}
+
+
+VFPEvaluation VFPInjEvaluator::bhp(double wat, double oil, double gas, double thp) const {
+    return this->bhp(this->coordinates(wat, oil, gas), thp);
+}
+
+
+VFPEvaluation VFPInjEvaluator::thp(double wat, double oil, double gas, double bhp) const {
+    std::vector<VFPEvaluation> bhp_values;
+    return this->thp(this->coordinates(wat, oil, gas), bhp, bhp_values);
+}
+
+
+void VFPInjEvaluator::bhp(std::size_t num_wells, const double* wat, const double* oil, const double* gas,
+                          const double* thp, VFPEvaluation* result) const {
+    const long size = static_cast<long>(num_wells);
+
+#pragma omp parallel for if (size > min_parallel_size)
+    for (long w = 0; w < size; w++)
+        result[w] = this->bhp(this->coordinates(wat[w], oil[w], gas[w]), thp[w]);
+}
+
+
+void VFPInjEvaluator::thp(std::size_t num_wells, const double* wat, const double* oil, const double* gas,
+                          const double* bhp, VFPEvaluation* result) const {
+    const long size = static_cast<long>(num_wells);
+
+#pragma omp parallel if (size > min_parallel_size)
+    {
+        std::vector<VFPEvaluation> bhp_values(m_thp_values.size());
+
+#pragma omp for
+        for (long w = 0; w < size; w++)
+            result[w] = this->thp(this->coordinates(wat[w], oil[w], gas[w]), bhp[w], bhp_values);
+    }
+}
+
+}
@@ -0,0 +1,135 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <fnmatch.h>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/Well/WellMatcher.hpp>
+
+namespace Opm {
+
+    WellMatcher::Pattern::Pattern(const std::string& pattern) :
+        kind(Kind::GLOB),
+        text(pattern)
+    {
+        if (pattern == "*")
+            this->kind = Kind::ALL;
+        else {
+            auto special_pos = pattern.find_first_of("*?[\\");
+            if (special_pos == pattern.size() - 1 && pattern.back() == '*') {
+                this->kind = Kind::PREFIX;
+                this->text = pattern.substr(0, special_pos);
+            }
+        }
+    }
+
+
+    bool WellMatcher::Pattern::match(const std::string& well) const {
+        switch (this->kind) {
+        case Kind::ALL:
+            return true;
+        case Kind::PREFIX:
+            return well.compare(0, this->text.size(), this->text) == 0;
+        case Kind::GLOB:
+            return fnmatch(this->text.c_str(), well.c_str(), 0) == 0;
+        }
+        return false;
+    }
+
+
+    void WellMatcher::Pattern::update(const std::vector<std::string>& wells) {
+        for (; this->num_scanned < wells.size(); this->num_scanned++) {
+            if (this->match(wells[this->num_scanned]))
+                this->matching.push_back(this->num_scanned);
+        }
+    }
+
+
+    const std::vector<std::size_t>& WellMatcher::Pattern::matches() const {
+        return this->matching;
+    }
+
+    /*****************************************************************/
+
+    WellMatcher::WellMatcher(const WellMatcher& other) :
+        wells(other.wells),
+        well_index(other.well_index)
+    {
+        std::lock_guard<std::mutex> lock(other.pattern_lock);
+        this->patterns = other.patterns;
+    }
+
+
+    WellMatcher& WellMatcher::operator=(const WellMatcher& other) {
+        if (this == &other)
+            return *this;
+
+        std::unique_lock<std::mutex> lock(this->pattern_lock, std::defer_lock);
+        std::unique_lock<std::mutex> other_lock(other.pattern_lock, std::defer_lock);
+        std::lock(lock, other_lock);
+
+        this->wells = other.wells;
+        this->well_index = other.well_index;
+        this->patterns = other.patterns;
+        return *this;
+    }
+
+
+    void WellMatcher::addWell(const std::string& well) {
+        if (this->hasWell(well))
+            return;
+
+        this->well_index.emplace(well, this->wells.size());
+        this->wells.push_back(well);
+    }
+
+
+    bool WellMatcher::hasWell(const std::string& well) const {
+        return (this->well_index.count(well) > 0);
+    }
+
+
+    std::size_t WellMatcher::size() const {
+        return this->wells.size();
+    }
+
+
+    /*
+      Will return the insertion index of all wells matching the pattern, in
+      insertion order. If the pattern does not contain a '*' it is interpreted
+      as a plain well name.
+    */
+    std::vector<std::size_t> WellMatcher::match(const std::string& pattern) const {
+        if (pattern.find('*') == std::string::npos) {
+            auto iter = this->well_index.find(pattern);
+            if (iter == this->well_index.end())
+                return {};
+
+            return { iter->second };
+        }
+
+        std::lock_guard<std::mutex> lock(this->pattern_lock);
+        auto iter = this->patterns.find(pattern);
+        if (iter == this->patterns.end())
+            iter = this->patterns.emplace(pattern, Pattern(pattern)).first;
+
+        auto& compiled_pattern = iter->second;
+        compiled_pattern.update(this->wells);
+        return compiled_pattern.matches();
+    }
+}
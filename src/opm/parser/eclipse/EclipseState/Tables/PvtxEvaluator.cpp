@@ -0,0 +1,186 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <opm/parser/eclipse/EclipseState/Tables/PvtxEvaluator.hpp>
+#include <opm/parser/eclipse/EclipseState/Tables/SimpleTable.hpp>
+
+namespace Opm {
+
+namespace {
+
+const long min_parallel_size = 1000;
+
+}
+
+
+PvtxEvaluator::PvtxEvaluator(const PvtxTable& table) {
+    if (table.size() == 0)
+        throw std::invalid_argument("Can not compile an empty PVT table");
+
+    const auto& first = table.getUnderSaturatedTable(0);
+    if (first.numColumns() < 2)
+        throw std::invalid_argument("The undersaturated PVT tables must have at least one value column");
+
+    m_numValues = first.numColumns() - 1;
+    for (std::size_t c = 0; c < m_numValues; c++)
+        m_columnNames.push_back(first.getColumn(c + 1).name());
+
+    m_offset.push_back(0);
+    for (std::size_t node = 0; node < table.size(); node++) {
+        m_outer.push_back(table.getArgValue(node));
+        if (node > 0)
+            m_outerInvWidth.push_back(1 / (m_outer[node] - m_outer[node - 1]));
+
+        const auto& underSaturated = table.getUnderSaturatedTable(node);
+        const auto& arg = underSaturated.getColumn(0);
+        const std::size_t numRows = arg.size();
+        const bool reverse = numRows > 1 && arg[0] > arg[numRows - 1];
+        const std::size_t begin = m_arg.size();
+
+        for (std::size_t i = 0; i < numRows; i++) {
+            const std::size_t row = reverse ? numRows - 1 - i : i;
+            m_arg.push_back(arg[row]);
+            for (std::size_t c = 0; c < m_numValues; c++)
+                m_values.push_back(underSaturated.get(c + 1, row));
+        }
+
+        /* The slope of the last row is zero: constant extrapolation. */
+        m_slopes.resize(m_values.size(), 0.0);
+        for (std::size_t r = begin; r + 1 < m_arg.size(); r++) {
+            const double invWidth = 1 / (m_arg[r + 1] - m_arg[r]);
+            for (std::size_t c = 0; c < m_numValues; c++)
+                m_slopes[r * m_numValues + c] = (m_values[(r + 1) * m_numValues + c] - m_values[r * m_numValues + c]) * invWidth;
+        }
+
+        m_offset.push_back(m_arg.size());
+    }
+}
+
+
+std::size_t PvtxEvaluator::numValueColumns() const {
+    return m_numValues;
+}
+
+
+std::size_t PvtxEvaluator::valueColumnIndex(const std::string& column) const {
+    const auto iter = std::find(m_columnNames.begin(), m_columnNames.end(), column);
+    if (iter == m_columnNames.end())
+        throw std::invalid_argument("Column " + column + " not found in PVT table");
+
+    return iter - m_columnNames.begin();
+}
+
+
+/*
+  The outer node below outerArg, and the weight of the node above it;
+  the weight is zero outside the table.
+*/
+std::size_t PvtxEvaluator::findOuter(double outerArg, double& weight) const {
+    weight = 0;
+    if (outerArg <= m_outer.front())
+        return 0;
+
+    if (outerArg >= m_outer.back())
+        return m_outer.size() - 1;
+
+    const std::size_t node = (std::upper_bound(m_outer.begin(), m_outer.end(), outerArg) - m_outer.begin()) - 1;
+    weight = (outerArg - m_outer[node]) * m_outerInvWidth[node];
+    return node;
+}
+
+
+/*
+  The packed row of the undersaturated table of node below innerArg, and
+  the distance dx from the argument of that row; the value is then
+  values[row] + dx * slopes[row].
+*/
+std::size_t PvtxEvaluator::findInner(std::size_t node, double innerArg, double& dx) const {
+    const std::size_t begin = m_offset[node];
+    const std::size_t end = m_offset[node + 1];
+
+    dx = 0;
+    if (innerArg <= m_arg[begin])
+        return begin;
+
+    if (innerArg >= m_arg[end - 1])
+        return end - 1;
+
+    const std::size_t row = (std::upper_bound(m_arg.begin() + begin, m_arg.begin() + end, innerArg) - m_arg.begin()) - 1;
+    dx = innerArg - m_arg[row];
+    return row;
+}
+
+
+double PvtxEvaluator::evaluate(std::size_t column, double outerArg, double innerArg) const {
+    if (column >= m_numValues)
+        throw std::invalid_argument("Invalid column index: " + std::to_string(column));
+
+    double weight, dx;
+    const std::size_t node = findOuter(outerArg, weight);
+
+    std::size_t row = findInner(node, innerArg, dx) * m_numValues + column;
+    double value = m_values[row] + dx * m_slopes[row];
+
+    if (weight > 0) {
+        row = findInner(node + 1, innerArg, dx) * m_numValues + column;
+        value = (1 - weight) * value + weight * (m_values[row] + dx * m_slopes[row]);
+    }
+
+    return value;
+}
+
+
+double PvtxEvaluator::evaluate(const std::string& column, double outerArg, double innerArg) const {
+    return evaluate(valueColumnIndex(column), outerArg, innerArg);
+}
+
+
+void PvtxEvaluator::evaluate(std::size_t n, const double* outerArg, const double* innerArg,
+                             double* fvf, double* viscosity) const {
+    if (m_numValues < 2)
+        throw std::invalid_argument("The PVT table has no viscosity column");
+
+    const std::size_t stride = m_numValues;
+    const double* values = m_values.data();
+    const double* slopes = m_slopes.data();
+
+#pragma omp parallel for if (static_cast<long>(n) > min_parallel_size)
+    for (long i = 0; i < static_cast<long>(n); i++) {
+        double weight, dx;
+        const std::size_t node = findOuter(outerArg[i], weight);
+
+        std::size_t row = findInner(node, innerArg[i], dx) * stride;
+        double b = values[row] + dx * slopes[row];
+        double mu = values[row + 1] + dx * slopes[row + 1];
+
+        if (weight > 0) {
+            row = findInner(node + 1, innerArg[i], dx) * stride;
+            b = (1 - weight) * b + weight * (values[row] + dx * slopes[row]);
+            mu = (1 - weight) * mu + weight * (values[row + 1] + dx * slopes[row + 1]);
+        }
+
+        fvf[i] = b;
+        viscosity[i] = mu;
+    }
+}
+
+}
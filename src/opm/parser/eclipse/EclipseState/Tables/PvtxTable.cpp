@@ -67,6 +67,7 @@ namespace Opm {
 
                 m_saturatedTable.addRow( row );
             }
+            m_saturatedTable.pack();
         }
     }
 
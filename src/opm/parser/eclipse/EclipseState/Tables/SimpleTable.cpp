@@ -16,6 +16,7 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <stdexcept>
 #include <utility>
 #include <iostream>
 
@@ -41,7 +42,78 @@ namespace Opm {
     }
 
 
+    /*
+      The copied columns own their values, the copy is packed into a
+      buffer of its own if the source table is packed.
+    */
+    SimpleTable::SimpleTable( const SimpleTable& other ) :
+        m_schema( other.m_schema ),
+        m_columns( other.m_columns ),
+        m_jfunc( other.m_jfunc )
+    {
+        if (other.packedData())
+            pack();
+    }
+
+
+    SimpleTable& SimpleTable::operator=( const SimpleTable& other ) {
+        if (this != &other) {
+            m_data.clear();
+            m_schema = other.m_schema;
+            m_columns = other.m_columns;
+            m_jfunc = other.m_jfunc;
+            if (other.packedData())
+                pack();
+        }
+        return *this;
+    }
+
+
+    void SimpleTable::pack() {
+        if (m_columns.size() == 0 || !m_data.empty())
+            return;
+
+        const size_t rows = numRows();
+        std::vector<double> data;
+        data.reserve( rows * m_columns.size() );
+        for (size_t colIdx = 0; colIdx < m_columns.size(); ++colIdx) {
+            const auto& column = m_columns.iget( colIdx );
+            if (column.size() != rows)
+                throw std::invalid_argument("Can not pack a table with columns of different length");
+
+            data.insert( data.end() , column.begin() , column.end() );
+        }
+
+        m_data.swap( data );
+        for (size_t colIdx = 0; colIdx < m_columns.size(); ++colIdx) {
+            auto& column = m_columns.iget( colIdx );
+            column.m_packed = m_data.data() + colIdx * rows;
+            std::vector<double>().swap( column.m_values );
+        }
+    }
+
+
+    void SimpleTable::unpack() {
+        if (m_data.empty())
+            return;
+
+        for (size_t colIdx = 0; colIdx < m_columns.size(); ++colIdx)
+            m_columns.iget( colIdx ).ownValues();
+
+        std::vector<double>().swap( m_data );
+    }
+
+
+    const double* SimpleTable::packedData() const {
+        if (m_data.empty())
+            return nullptr;
+
+        return m_data.data();
+    }
+
+
     void SimpleTable::addRow( const std::vector<double>& row) {
+        unpack();
         if (row.size() == numColumns()) {
             for (size_t colIndex  = 0; colIndex < numColumns(); colIndex++) {
                 auto& col = getColumn( colIndex );
@@ -95,6 +167,8 @@ namespace Opm {
             if (colIdx > 0)
                 column.applyDefaults(getColumn( 0 ));
         }
+
+        pack();
     }
 
     size_t SimpleTable::numColumns() const {
@@ -120,6 +194,7 @@ namespace Opm {
 
 
     TableColumn& SimpleTable::getColumn( const std::string& name) {
+        unpack();
         if (!this->m_jfunc)
             return m_columns.get( name );
 
@@ -129,6 +204,7 @@ namespace Opm {
     }
 
     TableColumn& SimpleTable::getColumn( size_t columnIndex ) {
+        unpack();
         return m_columns.iget( columnIndex );
     }
 
@@ -146,6 +222,38 @@ namespace Opm {
         return valueColumn.eval( index );
     }
 
+    size_t SimpleTable::getColumnIndex(const std::string& columnName) const {
+        if (this->m_jfunc && (columnName == "PCOW" || columnName == "PCOG"))
+            assertJFuncPressure(false); // this will throw since m_jfunc=true
+
+        for (size_t columnIndex = 0; columnIndex < m_schema.size(); ++columnIndex)
+            if (m_schema.getColumn( columnIndex ).name() == columnName)
+                return columnIndex;
+
+        throw std::invalid_argument("Column " + columnName + " not found in table");
+    }
+
+    double SimpleTable::evaluate(size_t columnIndex, double xPos) const
+    {
+        const auto& argColumn = getColumn( 0 );
+        const auto& valueColumn = getColumn( columnIndex );
+
+        const auto index = argColumn.lookup( xPos );
+        return valueColumn.eval( index );
+    }
+
+    void SimpleTable::evaluate(size_t columnIndex, const double* xPos, double* values, size_t n) const
+    {
+        getColumn( 0 ).lookupEval( xPos, n, getColumn( columnIndex ), values );
+    }
+
+    std::vector<double> SimpleTable::evaluate(const std::string& columnName, const std::vector<double>& xPos) const
+    {
+        std::vector<double> values( xPos.size() );
+        evaluate( getColumnIndex( columnName ), xPos.data(), values.data(), xPos.size() );
+        return values;
+    }
+
     void SimpleTable::assertJFuncPressure(const bool jf) const {
         if (jf == m_jfunc)
             return;
@@ -33,9 +33,40 @@ namespace Opm {
     }
 
 
+    TableColumn::TableColumn(const TableColumn& other) :
+        m_schema( other.m_schema ),
+        m_values( other.begin() , other.end() ),
+        m_default( other.m_default ),
+        m_defaultCount( other.m_defaultCount ),
+        m_minIndex( other.m_minIndex ),
+        m_maxIndex( other.m_maxIndex )
+    {
+    }
+
+
 
     size_t TableColumn::size() const {
-        return m_values.size();
+        return m_default.size();
+    }
+
+
+    const double* TableColumn::values() const {
+        if (m_packed)
+            return m_packed;
+
+        return m_values.data();
+    }
+
+
+    /*
+      Takes the values back from the buffer of a packed table, before the
+      column is modified.
+    */
+    void TableColumn::ownValues() {
+        if (m_packed) {
+            m_values.assign( m_packed , m_packed + size() );
+            m_packed = nullptr;
+        }
     }
 
 
@@ -45,14 +76,14 @@ namespace Opm {
     }
 
     const std::string& TableColumn::name() const {
-        return m_name;
+        return m_schema.name();
     }
 
     void TableColumn::assertNext(size_t index , double value) const {
         size_t nextIndex = index + 1;
-        if (nextIndex < m_values.size()) {
+        if (nextIndex < size()) {
             if (!m_default[nextIndex]) {
-                double nextValue = m_values[nextIndex];
+                double nextValue = values()[nextIndex];
                 assertOrder( value , nextValue );
             }
         }
@@ -63,7 +94,7 @@ namespace Opm {
         if (index > 0) {
             size_t prevIndex = index - 1;
             if (!m_default[prevIndex]) {
-                double prevValue = m_values[prevIndex];
+                double prevValue = values()[prevIndex];
                 assertOrder( prevValue , value );
             }
         }
@@ -79,9 +110,39 @@ namespace Opm {
 
 
     void TableColumn::addValue(double value) {
-        assertUpdate( m_values.size() , value );
+        assertUpdate( size() , value );
+        ownValues();
         m_values.push_back( value );
         m_default.push_back( false );
+
+        const size_t index = m_values.size() - 1;
+        if (m_values.size() - m_defaultCount == 1) {
+            m_minIndex = index;
+            m_maxIndex = index;
+        } else {
+            if (value < m_values[m_minIndex])
+                m_minIndex = index;
+
+            if (value > m_values[m_maxIndex])
+                m_maxIndex = index;
+        }
+    }
+
+
+    void TableColumn::updateExtrema() {
+        bool first = true;
+        for (size_t index = 0; index < m_values.size(); index++) {
+            if (m_default[index])
+                continue;
+
+            if (first || m_values[index] < m_values[m_minIndex])
+                m_minIndex = index;
+
+            if (first || m_values[index] > m_values[m_maxIndex])
+                m_maxIndex = index;
+
+            first = false;
+        }
     }
 
 
@@ -91,6 +152,7 @@ namespace Opm {
         if (defaultAction == Table::DEFAULT_CONST)
             addValue( m_schema.getDefaultValue( ));
         else if (defaultAction == Table::DEFAULT_LINEAR) {
+            ownValues();
             m_values.push_back( -1 ); // Should never even be read.
             m_default.push_back( true );
             m_defaultCount += 1;
@@ -102,44 +164,67 @@ namespace Opm {
 
     void TableColumn::updateValue(  size_t index , double value ) {
         assertUpdate( index , value );
+        ownValues();
+        const bool wasDefault = m_default[index];
         m_values[index] = value;
-        if (m_default[index]) {
+        if (wasDefault) {
             m_default[index] = false;
             m_defaultCount -= 1;
         }
+
+        if (m_values.size() - m_defaultCount == 1) {
+            m_minIndex = index;
+            m_maxIndex = index;
+            return;
+        }
+
+        /*
+          Overwriting the current minimum or maximum can move it anywhere;
+          all other updates can only extend the range.
+        */
+        if (!wasDefault && (index == m_minIndex || index == m_maxIndex)) {
+            updateExtrema();
+            return;
+        }
+
+        if (value < m_values[m_minIndex] || (value == m_values[m_minIndex] && index < m_minIndex))
+            m_minIndex = index;
+
+        if (value > m_values[m_maxIndex] || (value == m_values[m_maxIndex] && index < m_maxIndex))
+            m_maxIndex = index;
     }
 
     bool TableColumn::defaultApplied(size_t index) const {
-        if (index >= m_values.size())
-            throw std::invalid_argument("Value: " + std::to_string( index ) + " out of range: [0," + std::to_string( m_values.size()) + ")");
+        if (index >= size())
+            throw std::invalid_argument("Value: " + std::to_string( index ) + " out of range: [0," + std::to_string( size()) + ")");
 
         return m_default[index];
     }
 
     double TableColumn::operator[](size_t index) const {
-        if (index >= m_values.size())
-            throw std::invalid_argument("Value: " + std::to_string( index ) + " out of range: [0," + std::to_string( m_values.size()) + ")");
+        if (index >= size())
+            throw std::invalid_argument("Value: " + std::to_string( index ) + " out of range: [0," + std::to_string( size()) + ")");
 
         if (m_default[index])
             throw std::invalid_argument("Value at index " + std::to_string( index ) + " is defaulted - can not ask!");
 
-        return m_values[index];
+        return values()[index];
     }
 
     double TableColumn::back() const {
-        return m_values.back( );
+        return values()[size() - 1];
     }
 
 
     double TableColumn::front() const {
-        return m_values.front( );
+        return values()[0];
     }
 
     double TableColumn::max( ) const {
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
-        if (m_values.size() > 0)
-            return *std::max_element( m_values.begin() , m_values.end());
+        if (size() > 0)
+            return values()[m_maxIndex];
         else
             throw std::invalid_argument("Can not find max in empty column");
     }
@@ -148,15 +233,15 @@ namespace Opm {
     double TableColumn::min( ) const {
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
-        if (m_values.size() > 0)
-            return *std::min_element( m_values.begin() , m_values.end());
+        if (size() > 0)
+            return values()[m_minIndex];
         else
             throw std::invalid_argument("Can not find max in empty column");
     }
 
 
     bool TableColumn::inRange( double arg ) const {
-        if (m_values.size( ) >= 2) {
+        if (size( ) >= 2) {
             if (!m_schema.lookupValid( ))
                 throw std::invalid_argument("Must have an ordered column to check in range.");
 
@@ -170,7 +255,7 @@ namespace Opm {
     }
 
 
-    TableIndex TableColumn::lookup( double argValue ) const {
+    void TableColumn::assertLookup() const {
         if (!m_schema.lookupValid( ))
             throw std::invalid_argument("Must have an ordered column to perform table argument lookup.");
 
@@ -179,55 +264,125 @@ namespace Opm {
 
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
+    }
 
-        if (argValue >= max()) {
-            const auto max_iter = std::max_element( m_values.begin() , m_values.end());
-            const size_t max_index = max_iter - m_values.begin();
-            return TableIndex( max_index , 1.0 );
-        }
 
-        if (argValue <= min()) {
-            const auto min_iter = std::min_element( m_values.begin() , m_values.end());
-            const size_t min_index = min_iter - m_values.begin();
-            return TableIndex( min_index , 1.0 );
+    /*
+      Returns the interval idx with value[idx] < argValue <= value[idx + 1]
+      for increasing columns, and value[idx] >= argValue > value[idx + 1]
+      for decreasing columns; argValue must be strictly between min() and
+      max().
+    */
+    size_t TableColumn::lookupInterval( double argValue ) const {
+        const bool isDescending = m_schema.isDecreasing( );
+        const double* value = values();
+        size_t lowIntervalIdx = 0;
+        size_t intervalIdx = (size() - 1)/2;
+        size_t highIntervalIdx = size() - 1;
+
+        while (lowIntervalIdx + 1 < highIntervalIdx) {
+            if (isDescending) {
+                if (value[intervalIdx] < argValue)
+                    highIntervalIdx = intervalIdx;
+                else
+                    lowIntervalIdx = intervalIdx;
+            }
+            else {
+                if (value[intervalIdx] < argValue)
+                    lowIntervalIdx = intervalIdx;
+                else
+                    highIntervalIdx = intervalIdx;
+            }
+
+            intervalIdx = (highIntervalIdx + lowIntervalIdx)/2;
         }
 
-        {
-            bool isDescending = m_schema.isDecreasing( );
-            size_t lowIntervalIdx = 0;
-            size_t intervalIdx = (size() - 1)/2;
-            size_t highIntervalIdx = size() - 1;
-            double weight1;
-
-            while (lowIntervalIdx + 1 < highIntervalIdx) {
-                if (isDescending) {
-                    if (m_values[intervalIdx] < argValue)
-                        highIntervalIdx = intervalIdx;
-                    else
-                        lowIntervalIdx = intervalIdx;
-                }
-                else {
-                    if (m_values[intervalIdx] < argValue)
-                        lowIntervalIdx = intervalIdx;
-                    else
-                        highIntervalIdx = intervalIdx;
-                }
+        return intervalIdx;
+    }
+
 
-                intervalIdx = (highIntervalIdx + lowIntervalIdx)/2;
+    /*
+      As lookupInterval() above, but the interval hint is returned directly
+      if it contains argValue.
+    */
+    size_t TableColumn::lookupInterval( double argValue, size_t hint ) const {
+        if (hint + 1 < size()) {
+            const double* value = values();
+            if (m_schema.isDecreasing( )) {
+                if (value[hint] >= argValue && argValue > value[hint + 1])
+                    return hint;
+            } else {
+                if (value[hint] < argValue && argValue <= value[hint + 1])
+                    return hint;
             }
+        }
+
+        return lookupInterval( argValue );
+    }
+
+
+    TableIndex TableColumn::lookup( double argValue ) const {
+        assertLookup();
+
+        const double* value = values();
+        if (argValue >= value[m_maxIndex])
+            return TableIndex( m_maxIndex , 1.0 );
+
+        if (argValue <= value[m_minIndex])
+            return TableIndex( m_minIndex , 1.0 );
 
-            weight1 = 1 - (argValue - m_values[intervalIdx])/(m_values[intervalIdx + 1] - m_values[intervalIdx]);
+        {
+            size_t intervalIdx = lookupInterval( argValue );
+            double weight1 = 1 - (argValue - value[intervalIdx])/(value[intervalIdx + 1] - value[intervalIdx]);
 
             return TableIndex( intervalIdx , weight1 );
         }
     }
 
-    std::vector<double>::const_iterator TableColumn::begin() const {
-        return m_values.begin();
+
+    void TableColumn::lookupEval(const double* argValues, size_t n, const TableColumn& valueColumn, double* values) const {
+        assertLookup();
+
+        if (valueColumn.size() != size())
+            throw std::invalid_argument("Size mismatch between argument column and value column");
+
+        const double* arg = this->values();
+        const double* value = valueColumn.values();
+        const double maxArg = arg[m_maxIndex];
+        const double minArg = arg[m_minIndex];
+
+#pragma omp parallel if (n > 10000)
+        {
+            size_t hint = 0;
+
+#pragma omp for
+            for (long i = 0; i < static_cast<long>(n); i++) {
+                const double argValue = argValues[i];
+
+                if (argValue >= maxArg)
+                    values[i] = value[m_maxIndex];
+                else if (argValue <= minArg)
+                    values[i] = value[m_minIndex];
+                else {
+                    hint = lookupInterval( argValue , hint );
+
+                    const double weight1 = 1 - (argValue - arg[hint])/(arg[hint + 1] - arg[hint]);
+                    double result = value[hint] * weight1;
+                    if (weight1 < 1.0)
+                        result += (1 - weight1) * value[hint + 1];
+
+                    values[i] = result;
+                }
+            }
+        }
+    }
+
+    const double* TableColumn::begin() const {
+        return values();
     }
 
-    std::vector<double>::const_iterator TableColumn::end() const {
-        return m_values.end();
+    const double* TableColumn::end() const {
+        return values() + size();
     }
 
 
@@ -242,10 +397,10 @@ namespace Opm {
     double TableColumn::eval( const TableIndex& index) const {
         size_t index1 = index.getIndex1();
         double weight1 = index.getWeight1( );
-        double value = m_values[index1] * weight1;
+        double value = values()[index1] * weight1;
         if (weight1 < 1.0) {
             double weight2 = index.getWeight2( );
-            value += weight2 * m_values[index1 + 1];
+            value += weight2 * values()[index1 + 1];
         }
         return value;
     }
@@ -254,10 +409,12 @@ namespace Opm {
     TableColumn& TableColumn::operator= (const TableColumn& other) {
         if (this != &other) {
             m_schema = other.m_schema;
-            m_name = other.m_name;
-            m_values = other.m_values;
+            m_values.assign( other.begin() , other.end() );
+            m_packed = nullptr;
             m_default = other.m_default;
             m_defaultCount = other.m_defaultCount;
+            m_minIndex = other.m_minIndex;
+            m_maxIndex = other.m_maxIndex;
         }
         return *this;
     }
@@ -297,7 +454,7 @@ namespace Opm {
                         if (rowBeforeIdx != rowAfterIdx)
                             alpha = (argColumn[rowIdx] - argColumn[rowBeforeIdx]) / (argColumn[rowAfterIdx] - argColumn[rowBeforeIdx]);
 
-                        double value = m_values[rowBeforeIdx]*(1-alpha) + m_values[rowAfterIdx]*alpha;
+                        double value = values()[rowBeforeIdx]*(1-alpha) + values()[rowAfterIdx]*alpha;
 
                         updateValue( rowIdx , value );
                     }
@@ -17,15 +17,18 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdexcept>
 #include <string>
-#include <iostream>
 
+#include <opm/parser/eclipse/EclipseState/Tables/SimpleTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/TableContainer.hpp>
 
 namespace Opm {
 
     TableContainer::TableContainer(size_t maxTables) :
-        m_maxTables(maxTables)
+        m_maxTables(maxTables),
+        m_resolved(maxTables, maxTables),
+        m_lookup(maxTables, nullptr)
     {
     }
 
@@ -41,26 +44,27 @@ namespace Opm {
 
 
     size_t TableContainer::hasTable(size_t tableNumber) const {
-        if (m_tables.find( tableNumber ) == m_tables.end())
+        if (tableNumber >= m_maxTables)
             return false;
-        else
-            return true;
+
+        return m_resolved[tableNumber] == tableNumber;
     }
 
 
-    const SimpleTable& TableContainer::getTable(size_t tableNumber) const {
+    size_t TableContainer::resolveTableNumber(size_t tableNumber) const {
         if (tableNumber >= m_maxTables)
             throw std::invalid_argument("TableContainer - invalid tableNumber");
 
-        if (hasTable(tableNumber)) {
-            auto pair = m_tables.find( tableNumber );
-            return *(pair->second.get());
-        } else {
-            if (tableNumber > 0)
-                return getTable(tableNumber -1);
-            else
-                throw std::invalid_argument("TableContainer does not have any table in the range 0..." + std::to_string( tableNumber ));
-        }
+        const size_t resolved = m_resolved[tableNumber];
+        if (resolved == m_maxTables)
+            throw std::invalid_argument("TableContainer does not have any table in the range 0..." + std::to_string( tableNumber ));
+
+        return resolved;
+    }
+
+
+    const SimpleTable& TableContainer::getTable(size_t tableNumber) const {
+        return *m_lookup[ resolveTableNumber( tableNumber ) ];
     }
 
 
@@ -68,13 +72,34 @@ namespace Opm {
         return getTable(tableNumber);
     }
 
+
+    TableContainer::PackedTable TableContainer::getPackedTable(size_t tableNumber) const {
+        const auto& table = getTable( tableNumber );
+        const double* data = table.packedData();
+        if (!data)
+            throw std::logic_error("TableContainer - table " + std::to_string( tableNumber ) + " is not packed");
+
+        return { data , table.numRows() , table.numColumns() };
+    }
+
+
+    /*
+      Table N is used for all the slots N, N + 1, ... up to the next slot
+      which has a table of its own.
+    */
     void TableContainer::addTable(size_t tableNumber , std::shared_ptr<const SimpleTable> table) {
         if (tableNumber >= m_maxTables)
             throw std::invalid_argument("TableContainer has max: " + std::to_string( m_maxTables ) + " tables. Table number: " + std::to_string( tableNumber ) + " illegal.");
 
         m_tables[tableNumber] = table;
-    }
-}
 
+        for (size_t slot = tableNumber; slot < m_maxTables; slot++) {
+            if (slot > tableNumber && m_resolved[slot] == slot)
+                break;
 
+            m_resolved[slot] = tableNumber;
+            m_lookup[slot] = table.get();
+        }
+    }
 
+}
@@ -472,6 +472,7 @@ PlymaxTable::PlymaxTable( const DeckRecord& record ) {
 
         column.addValue( record.getItem( colIdx ).getSIDouble(0) );
     }
+    SimpleTable::pack();
 }
 
 const TableColumn& PlymaxTable::getPolymerConcentrationColumn() const {
@@ -495,6 +496,7 @@ PlyrockTable::PlyrockTable( const DeckRecord& record ) {
 
         column.addValue( record.getItem( colIdx ).getSIDouble(0) );
     }
+    SimpleTable::pack();
 }
 
 const TableColumn& PlyrockTable::getDeadPoreVolumeColumn() const {
@@ -695,6 +697,7 @@ GasvisctTable::GasvisctTable( const Deck& deck, const DeckItem& deckItem ) {
             }
         }
     }
+    SimpleTable::pack();
 }
 
 const TableColumn& GasvisctTable::getTemperatureColumn() const {
@@ -931,33 +931,60 @@ namespace {
         return !( *this == rhs );
     }
 
+    namespace {
+        const long min_parallel_size = 100000;
+    }
+
+    void UnitSystem::Conversion::operator()( const double* input, double* output, std::size_t size ) const {
+        const double factor = this->factor;
+        const double offset = this->offset;
+
+        if (this->from_si) {
+#pragma omp parallel for if (static_cast<long>(size) > min_parallel_size)
+            for (long i = 0; i < static_cast<long>(size); i++)
+                output[i] = factor * (input[i] - offset);
+        } else {
+#pragma omp parallel for if (static_cast<long>(size) > min_parallel_size)
+            for (long i = 0; i < static_cast<long>(size); i++)
+                output[i] = factor * input[i] + offset;
+        }
+    }
+
+    UnitSystem::Conversion UnitSystem::from_si_conversion( measure m ) const {
+        return { this->measure_table_from_si[ static_cast< int >( m ) ],
+                 this->measure_table_to_si_offset[ static_cast< int >( m ) ],
+                 true };
+    }
+
+    UnitSystem::Conversion UnitSystem::to_si_conversion( measure m ) const {
+        return { this->measure_table_to_si[ static_cast< int >( m ) ],
+                 this->measure_table_to_si_offset[ static_cast< int >( m ) ],
+                 false };
+    }
+
     double UnitSystem::from_si( measure m, double val ) const {
-        return
-            this->measure_table_from_si[ static_cast< int >( m ) ]
-            * (val - this->measure_table_to_si_offset[ static_cast< int >( m ) ]);
+        return this->from_si_conversion( m )( val );
     }
 
     double UnitSystem::to_si( measure m, double val ) const {
-        return
-            this->measure_table_to_si[ static_cast< int >( m ) ]*val
-            + this->measure_table_to_si_offset[ static_cast< int >( m ) ];
+        return this->to_si_conversion( m )( val );
     }
 
     void UnitSystem::from_si( measure m, std::vector<double>& data ) const {
-        double factor = this->measure_table_from_si[ static_cast< int >( m ) ];
-        double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
-        auto scale = [=](double x) { return (x - offset) * factor; };
-        std::transform( data.begin() , data.end() , data.begin() , scale);
+        this->from_si( m, data.data(), data.data(), data.size() );
     }
 
-
     void UnitSystem::to_si( measure m, std::vector<double>& data) const {
-        double factor = this->measure_table_to_si[ static_cast< int >( m ) ];
-        double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
-        auto scale = [=](double x) { return x * factor + offset; };
-        std::transform( data.begin() , data.end() , data.begin() , scale);
+        this->to_si( m, data.data(), data.data(), data.size() );
     }
 
+    void UnitSystem::from_si( measure m, const double* input, double* output, std::size_t size ) const {
+        this->from_si_conversion( m )( input, output, size );
+    }
+
+    void UnitSystem::to_si( measure m, const double* input, double* output, std::size_t size ) const {
+        this->to_si_conversion( m )( input, output, size );
+    }
 
 
     const char* UnitSystem::name( measure m ) const {
@@ -123,6 +123,62 @@ Deviation ECLFilesComparator::calculateDeviations(double val1, double val2) {
 }
 
 
+/*
+  The same test as calculateDeviations() followed by the tolerance check in
+  ECLRegressionTest::deviationsForCell(), written without branches so that
+  the loop in exceedingDeviations() can be vectorised.
+*/
+static inline bool exceedsTolerances(double val1, double val2,
+                                     double absTolerance, double relTolerance,
+                                     bool allowNegativeValues) {
+    bool exceeds = false;
+    if (!allowNegativeValues) {
+        exceeds = (val1 < 0 && -val1 > absTolerance) || (val2 < 0 && -val2 > absTolerance);
+        val1 = val1 < 0 ? 0 : val1;
+        val2 = val2 < 0 ? 0 : val2;
+    }
+
+    val1 = std::abs(val1);
+    val2 = std::abs(val2);
+
+    const bool nonZero = (val1 != 0 || val2 != 0);
+    const bool bothNonZero = (val1 != 0 && val2 != 0);
+    const double absDev = nonZero ? std::abs(val1 - val2) : -1;
+    const double relDev = bothNonZero ? absDev / std::max(val1, val2) : -1;
+
+    return exceeds || (absDev > absTolerance && (relDev > relTolerance || relDev == -1));
+}
+
+
+template <typename T>
+std::vector<size_t> ECLFilesComparator::exceedingDeviations(const std::vector<T>& t1, const std::vector<T>& t2,
+                                                            double absTolerance, double relTolerance,
+                                                            bool allowNegativeValues) {
+    const long size = std::min(t1.size(), t2.size());
+    const T* data1 = t1.data();
+    const T* data2 = t2.data();
+    std::vector<char> exceeds(size);
+
+#pragma omp parallel for simd if (size > 100000)
+    for (long i = 0; i < size; i++) {
+        exceeds[i] = exceedsTolerances(static_cast<double>(data1[i]), static_cast<double>(data2[i]),
+                                       absTolerance, relTolerance, allowNegativeValues);
+    }
+
+    std::vector<size_t> indices;
+    for (long i = 0; i < size; i++) {
+        if (exceeds[i]) {
+            indices.push_back(i);
+        }
+    }
+
+    return indices;
+}
+
+template std::vector<size_t> ECLFilesComparator::exceedingDeviations<float> (const std::vector<float>&  t1, const std::vector<float>&  t2, double absTolerance, double relTolerance, bool allowNegativeValues);
+template std::vector<size_t> ECLFilesComparator::exceedingDeviations<double>(const std::vector<double>& t1, const std::vector<double>& t2, double absTolerance, double relTolerance, bool allowNegativeValues);
+
+
 double ECLFilesComparator::median(std::vector<double> vec) {
     if (vec.empty()) {
         return 0;
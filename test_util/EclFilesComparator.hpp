@@ -61,6 +61,12 @@ public:
     //! \brief Calculate deviations for two values.
     //! \details Using absolute values of the input arguments: If one of the values are non-zero, the Deviation::abs returned is the difference between the two input values. In addition, if both values are non-zero, the Deviation::rel returned is the absolute deviation divided by the largest value.
     static Deviation calculateDeviations(double val1, double val2);
+    //! \brief Find the elements of two vectors where the deviations exceed the tolerances.
+    //! \details Returns, in increasing order, the indices i where calculateDeviations(t1[i], t2[i]) gives an absolute deviation larger than absTolerance, and a relative deviation which is larger than relTolerance or invalid. If allowNegativeValues is false, negative values are counted as zero, and the indices where the absolute value of a negative value exceeds absTolerance are also returned. The comparison is vectorised, and large vectors are processed in parallel.
+    template <typename T>
+    static std::vector<size_t> exceedingDeviations(const std::vector<T>& t1, const std::vector<T>& t2,
+                                                   double absTolerance, double relTolerance,
+                                                   bool allowNegativeValues);
     //! \brief Calculate median of a vector.
     //! \details Returning the median of the input vector, i.e. the middle value of the sorted vector if the number of elements is odd or the mean of the two middle values if the number of elements are even. Copy is intentional.
     static double median(std::vector<double> vec);
@@ -28,11 +28,15 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <exception>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <set>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 // helper macro to handle error throws or not
@@ -61,6 +65,52 @@ static bool fileExists(const std::string& fileName) {
 }
 
 
+// Maps each keyword to the position of its first occurrence in the list.
+static std::unordered_map<std::string, size_t> keywordIndex(const std::vector<std::string>& keywords) {
+    std::unordered_map<std::string, size_t> index;
+    for (size_t i = 0; i < keywords.size(); i++) {
+        index.emplace(keywords[i], i);
+    }
+    return index;
+}
+
+
+// Runs the two load operations, typically the same load for the two cases,
+// concurrently. An exception from one of them is rethrown in the calling thread.
+template <typename Load1, typename Load2>
+static void loadInParallel(Load1 load1, Load2 load2) {
+    std::exception_ptr error1, error2;
+
+#pragma omp parallel sections num_threads(2)
+    {
+#pragma omp section
+        {
+            try {
+                load1();
+            } catch (...) {
+                error1 = std::current_exception();
+            }
+        }
+#pragma omp section
+        {
+            try {
+                load2();
+            } catch (...) {
+                error2 = std::current_exception();
+            }
+        }
+    }
+
+    if (error1) {
+        std::rethrow_exception(error1);
+    }
+
+    if (error2) {
+        std::rethrow_exception(error2);
+    }
+}
+
+
 bool ECLRegressionTest::checkFileName(const std::string &rootName, const std::string &extension, std::string &filename) {
 
     if (fileExists(rootName + "." + extension)) {
@@ -101,7 +151,12 @@ void ECLRegressionTest::compareFloatingPointVectors(const std::vector<T>& t1, co
     it = std::find(keywordsStrictTol.begin(), keywordsStrictTol.end(), keyword);
     bool strictTol = it != keywordsStrictTol.end() ? true : false;
 
-    for (size_t i = 0; i < t1.size(); i++) {
+    double absTolerance = strictTol ? strictAbsTol : getAbsTolerance();
+    double relTolerance = strictTol ? strictAbsTol : getRelTolerance();
+
+    // Only the cells found by the vectorised check are passed on to
+    // deviationsForCell() for reporting.
+    for (size_t i : exceedingDeviations(t1, t2, absTolerance, relTolerance, allowNegatives)) {
         deviationsForCell(static_cast<double>(t1[i]),
                           static_cast<double>(t2[i]),
                           keyword, reference, t1.size(),
@@ -187,14 +242,6 @@ void ECLRegressionTest::deviationsForCell(double val1, double val2, const std::s
                          << "\nThe relative deviation is " << dev.rel << ", and the tolerance limit is " << relTolerance << ".");
         }
     }
-
-    if (dev.abs != -1) {
-        absDeviation.push_back(dev.abs);
-    }
-
-    if (dev.rel != -1) {
-        relDeviation.push_back(dev.rel);
-    }
 }
 
 
@@ -240,9 +287,10 @@ void ECLRegressionTest::compareKeywords(const std::vector<std::string> &keywords
             OPM_THROW(std::runtime_error, "\nKeywords not identical in " << reference);
         }
     } else {
+        const std::unordered_set<std::string> keywordSet2(keywords2.begin(), keywords2.end());
+
         for (auto& keyword : keywords1) {
-            auto it1 = std::find(keywords2.begin(), keywords2.end(), keyword);
-            if (it1 == keywords2.end()) {
+            if (keywordSet2.count(keyword) == 0) {
                 std::cout << "Keyword " << keyword << " missing in second file " << std::endl;
 
                 if (keywords1.size() > 50) {
@@ -395,14 +443,15 @@ void ECLRegressionTest::gridCompare()
 
         std::cout << "Active cells           " << " ... ";
 
-        for (int k = 0; k < ijk1[2]; k++) {
-            for (int j=0; j < ijk1[1]; j++) {
-                for (int i = 0; i < ijk2[0]; i++) {
-                    if (grid1->active_index(i,j,k) != grid2->active_index(i,j,k)) {
-                        OPM_THROW(std::runtime_error, "\nGrid1 and grid2 have different definition of active cells. "
-                                  " First difference found for cell i="<< i+1 << " j=" << j+1 << " k=" << k+1);
-                    }
-                }
+        {
+            const auto& actmap1 = grid1->activeIndexMap().globalToActive();
+            const auto& actmap2 = grid2->activeIndexMap().globalToActive();
+            auto diff = std::mismatch(actmap1.begin(), actmap1.end(), actmap2.begin());
+
+            if (diff.first != actmap1.end()) {
+                auto ijk = grid1->ijk_from_global_index(std::distance(actmap1.begin(), diff.first));
+                OPM_THROW(std::runtime_error, "\nGrid1 and grid2 have different definition of active cells. "
+                          " First difference found for cell i="<< ijk[0]+1 << " j=" << ijk[1]+1 << " k=" << ijk[2]+1);
             }
         }
 
@@ -413,45 +462,40 @@ void ECLRegressionTest::gridCompare()
         std::vector<double> X1(8,0.0), Y1(8,0.0) , Z1(8,0.0);
         std::vector<double> X2(8,0.0), Y2(8,0.0), Z2(8,0.0);
 
-        for (int k = 0; k < ijk1[2]; k++) {
-            for (int j = 0; j < ijk1[1]; j++) {
-                for (int i = 0; i < ijk1[0]; i++) {
-                    if (grid1->active_index(i,j,k) > -1) {
-                        grid1->getCellCorners({i,j,k}, X1, Y1, Z1);
-                        grid2->getCellCorners({i,j,k}, X2, Y2, Z2);
-
-                        for (int n = 0; n < 8; n++) {
-                            Deviation devX = calculateDeviations(X1[n], X2[n]);
-                            Deviation devY = calculateDeviations(Y1[n], Y2[n]);
-                            Deviation devZ = calculateDeviations(Z1[n], Z2[n]);
-
-                            if (devX.abs > strictAbsTol) {
-                                if (analysis) {
-                                    deviations["xcoordinate"].push_back(devX);
-                                } else {
-                                    OPM_THROW(std::runtime_error, "\nGrid1 and grid2 have different X, Y and/or Z coordinates . "
-                                              " First difference found for cell i="<< i+1 << " j=" << j+1 << " k=" << k+1);
-                                }
-                            }
-
-                            if (devY.abs > strictAbsTol) {
-                                if (analysis) {
-                                    deviations["ycoordinate"].push_back(devY);
-                                } else {
-                                    OPM_THROW(std::runtime_error, "\nGrid1 and grid2 have different X, Y and/or Z coordinates . "
-                                              " First difference found for cell i="<< i+1 << " j=" << j+1 << " k=" << k+1);
-                                }
-                            }
-
-                            if (devZ.abs > strictAbsTol) {
-                                if (analysis) {
-                                    deviations["zcoordinate"].push_back(devZ);
-                                } else {
-                                    OPM_THROW(std::runtime_error, "\nGrid1 and grid2 have different X, Y and/or Z coordinates . "
-                                              " First difference found for cell i="<< i+1 << " j=" << j+1 << " k=" << k+1);
-                                }
-                            }
-                        }
+        for (int globalIndex : grid1->activeIndexMap().activeToGlobal()) {
+            const auto ijk = grid1->ijk_from_global_index(globalIndex);
+            grid1->getCellCorners(ijk, X1, Y1, Z1);
+            grid2->getCellCorners(ijk, X2, Y2, Z2);
+
+            for (int n = 0; n < 8; n++) {
+                Deviation devX = calculateDeviations(X1[n], X2[n]);
+                Deviation devY = calculateDeviations(Y1[n], Y2[n]);
+                Deviation devZ = calculateDeviations(Z1[n], Z2[n]);
+
+                if (devX.abs > strictAbsTol) {
+                    if (analysis) {
+                        deviations["xcoordinate"].push_back(devX);
+                    } else {
+                        OPM_THROW(std::runtime_error, "\nGrid1 and grid2 have different X, Y and/or Z coordinates . "
+                                  " First difference found for cell i="<< ijk[0]+1 << " j=" << ijk[1]+1 << " k=" << ijk[2]+1);
+                    }
+                }
+
+                if (devY.abs > strictAbsTol) {
+                    if (analysis) {
+                        deviations["ycoordinate"].push_back(devY);
+                    } else {
+                        OPM_THROW(std::runtime_error, "\nGrid1 and grid2 have different X, Y and/or Z coordinates . "
+                                  " First difference found for cell i="<< ijk[0]+1 << " j=" << ijk[1]+1 << " k=" << ijk[2]+1);
+                    }
+                }
+
+                if (devZ.abs > strictAbsTol) {
+                    if (analysis) {
+                        deviations["zcoordinate"].push_back(devZ);
+                    } else {
+                        OPM_THROW(std::runtime_error, "\nGrid1 and grid2 have different X, Y and/or Z coordinates . "
+                                  " First difference found for cell i="<< ijk[0]+1 << " j=" << ijk[1]+1 << " k=" << ijk[2]+1);
                     }
                 }
             }
@@ -534,9 +578,6 @@ void ECLRegressionTest::results_init()
 
         deviations.clear();
 
-        init1.loadData();
-        init2.loadData();
-
         std::string reference = "Init file";
 
         auto arrayList1 = init1.getList();
@@ -569,9 +610,12 @@ void ECLRegressionTest::results_init()
                 checkSpesificKeyword(keywords1, keywords2, arrayType1, arrayType2, reference);
             }
 
+            const auto index2 = keywordIndex(keywords2);
+
+            // The arrays are loaded pairwise, and released again when they
+            // have been compared.
             for (size_t i = 0; i < keywords1.size(); i++) {
-                auto it1 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
-                int ind2 = std::distance(keywords2.begin(),it1);
+                size_t ind2 = index2.at(keywords1[i]);
 
                 if (arrayType1[i] != arrayType2[ind2]) {
                     printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
@@ -580,25 +624,28 @@ void ECLRegressionTest::results_init()
 
                 std::cout << "Comparing " << keywords1[i] << " ... ";
 
+                loadInParallel([&init1, &keywords1, i]() { init1.loadData(keywords1[i]); },
+                               [&init2, &keywords2, ind2]() { init2.loadData(keywords2[ind2]); });
+
                 if (arrayType1[i] == INTE) {
-                    auto vect1 = init1.get<int>(keywords1[i]);
-                    auto vect2 = init2.get<int>(keywords2[ind2]);
+                    const auto& vect1 = init1.get<int>(keywords1[i]);
+                    const auto& vect2 = init2.get<int>(keywords2[ind2]);
                     compareVectors(vect1, vect2, keywords1[i],reference);
                 } else if (arrayType1[i] == REAL) {
-                    auto vect1 = init1.get<float>(keywords1[i]);
-                    auto vect2 = init2.get<float>(keywords2[ind2]);
+                    const auto& vect1 = init1.get<float>(keywords1[i]);
+                    const auto& vect2 = init2.get<float>(keywords2[ind2]);
                     compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
                 } else if (arrayType1[i] == DOUB) {
-                    auto vect1 = init1.get<double>(keywords1[i]);
-                    auto vect2 = init2.get<double>(keywords2[ind2]);
+                    const auto& vect1 = init1.get<double>(keywords1[i]);
+                    const auto& vect2 = init2.get<double>(keywords2[ind2]);
                     compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
                 } else if (arrayType1[i] == LOGI) {
-                    auto vect1 = init1.get<bool>(keywords1[i]);
-                    auto vect2 = init2.get<bool>(keywords2[ind2]);
+                    const auto& vect1 = init1.get<bool>(keywords1[i]);
+                    const auto& vect2 = init2.get<bool>(keywords2[ind2]);
                     compareVectors(vect1, vect2, keywords1[i], reference);
                 } else if (arrayType1[i] == CHAR) {
-                    auto vect1 = init1.get<std::string>(keywords1[i]);
-                    auto vect2 = init2.get<std::string>(keywords2[ind2]);
+                    const auto& vect1 = init1.get<std::string>(keywords1[i]);
+                    const auto& vect2 = init2.get<std::string>(keywords2[ind2]);
                     compareVectors(vect1, vect2, keywords1[i], reference);
                 } else if (arrayType1[i] == MESS) {
                     // shold not be any associated data
@@ -607,6 +654,9 @@ void ECLRegressionTest::results_init()
                     exit(1);
                 }
 
+                init1.unloadData(keywords1[i]);
+                init2.unloadData(keywords2[ind2]);
+
                 std::cout << " done." << std::endl;
             }
 
@@ -696,8 +746,8 @@ void ECLRegressionTest::results_rst()
 
             std::string reference = "Restart, sequence "+std::to_string(seqn);
 
-            rst1.loadReportStepNumber(seqn);
-            rst2.loadReportStepNumber(seqn);
+            loadInParallel([&rst1, seqn]() { rst1.loadReportStepNumber(seqn); },
+                           [&rst2, seqn]() { rst2.loadReportStepNumber(seqn); });
 
             auto arrays1 = rst1.listOfRstArrays(seqn);
             auto arrays2 = rst2.listOfRstArrays(seqn);
@@ -718,13 +768,13 @@ void ECLRegressionTest::results_rst()
 
             if (integrationTest) {
                 std::vector<std::string> keywords;
+                const std::unordered_set<std::string> keywordSet2(keywords2.begin(), keywords2.end());
 
                 for (size_t i = 0; i < keywords1.size(); i++) {
                     if (keywords1[i] == "PRESSURE" ||
                         keywords1[i] == "SWAT" ||
                         keywords1[i] =="SGAS") {
-                        auto search2 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
-                        if (search2 != keywords2.end()) {
+                        if (keywordSet2.count(keywords1[i]) > 0) {
                             keywords.push_back(keywords1[i]);
                         }
                     }
@@ -746,9 +796,10 @@ void ECLRegressionTest::results_rst()
                     checkSpesificKeyword(keywords1, keywords2, arrayType1, arrayType2, reference);
                 }
 
+                const auto index2 = keywordIndex(keywords2);
+
                 for (size_t i = 0; i < keywords1.size(); i++) {
-                    auto it1 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
-                    int ind2 = std::distance(keywords2.begin(), it1);
+                    size_t ind2 = index2.at(keywords1[i]);
 
                     if (arrayType1[i] != arrayType2[ind2]) {
                         printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
@@ -759,24 +810,24 @@ void ECLRegressionTest::results_rst()
                     std::cout << "Comparing " << keywords1[i] << " ... ";
 
                     if (arrayType1[i] == INTE) {
-                        auto vect1 = rst1.getRst<int>(keywords1[i], seqn);
-                        auto vect2 = rst2.getRst<int>(keywords2[ind2], seqn);
+                        const auto& vect1 = rst1.getRst<int>(keywords1[i], seqn);
+                        const auto& vect2 = rst2.getRst<int>(keywords2[ind2], seqn);
                         compareVectors(vect1, vect2, keywords1[i], reference);
                     } else if (arrayType1[i] == REAL) {
-                        auto vect1 = rst1.getRst<float>(keywords1[i], seqn);
-                        auto vect2 = rst2.getRst<float>(keywords2[ind2], seqn);
+                        const auto& vect1 = rst1.getRst<float>(keywords1[i], seqn);
+                        const auto& vect2 = rst2.getRst<float>(keywords2[ind2], seqn);
                         compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
                     } else if (arrayType1[i] == DOUB) {
-                        auto vect1 = rst1.getRst<double>(keywords1[i], seqn);
-                        auto vect2 = rst2.getRst<double>(keywords2[ind2], seqn);
+                        const auto& vect1 = rst1.getRst<double>(keywords1[i], seqn);
+                        const auto& vect2 = rst2.getRst<double>(keywords2[ind2], seqn);
                         compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
                     } else if (arrayType1[i] == LOGI) {
-                        auto vect1 = rst1.getRst<bool>(keywords1[i], seqn);
-                        auto vect2 = rst2.getRst<bool>(keywords2[ind2], seqn);
+                        const auto& vect1 = rst1.getRst<bool>(keywords1[i], seqn);
+                        const auto& vect2 = rst2.getRst<bool>(keywords2[ind2], seqn);
                         compareVectors(vect1, vect2, keywords1[i], reference);
                     } else if (arrayType1[i] == CHAR) {
-                        auto vect1 = rst1.getRst<std::string>(keywords1[i], seqn);
-                        auto vect2 = rst2.getRst<std::string>(keywords2[ind2], seqn);
+                        const auto& vect1 = rst1.getRst<std::string>(keywords1[i], seqn);
+                        const auto& vect2 = rst2.getRst<std::string>(keywords2[ind2], seqn);
                         compareVectors(vect1, vect2, keywords1[i], reference);
                     } else if (arrayType1[i] == MESS) {
                         // shold not be any associated data
@@ -788,6 +839,9 @@ void ECLRegressionTest::results_rst()
                     std::cout << " done." << std::endl;
                 }
             }
+
+            rst1.unloadReportStepNumber(seqn);
+            rst2.unloadReportStepNumber(seqn);
         }
 
         if (!deviations.empty()) {
@@ -839,8 +893,7 @@ void ECLRegressionTest::results_smry()
                     keywords1[i].substr(0,5) == "WWPR:" ||
                     keywords1[i].substr(0,5) == "WGPR:" ||
                     keywords1[i].substr(0,5 )== "WBHP:") {
-                    auto search2 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
-                    if (search2 != keywords2.end()) {
+                    if (smry2.hasKey(keywords1[i])) {
                         keywords.push_back(keywords1[i]);
                     }
                 }
@@ -870,8 +923,8 @@ void ECLRegressionTest::results_smry()
             std::cout << "\nChecking " << keywords1.size() << "  vectors  ... ";
 
             for (size_t i = 0; i < keywords1.size(); i++) {
-                std::vector<float> vect1 = smry1.get( keywords1[i]);
-                std::vector<float> vect2 = smry2.get( keywords1[i]);
+                const std::vector<float>& vect1 = smry1.get( keywords1[i]);
+                const std::vector<float>& vect2 = smry2.get( keywords1[i]);
 
                 if (vect1.size() != vect2.size()) {
                     OPM_THROW(std::runtime_error, "\nKeyword " << keywords1[i] << " summary vector of different length");
@@ -1052,30 +1105,33 @@ void ECLRegressionTest::printComparisonForKeywordLists(const std::vector<std::st
 
     std::cout << std::endl;
 
-    for (auto& it : commonList) {
-        auto it1 = std::find(arrayList1.begin(), arrayList1.end(), it);
-        int ind1 = std::distance(arrayList1.begin(), it1);
+    const auto index1 = keywordIndex(arrayList1);
+    const auto index2 = keywordIndex(arrayList2);
 
-        auto it2 = std::find(arrayList2.begin(), arrayList2.end(), it);
-        int ind2 = std::distance(arrayList2.begin(),it2);
+    for (auto& it : commonList) {
+        auto it1 = index1.find(it);
+        auto it2 = index2.find(it);
+        bool found1 = it1 != index1.end();
+        bool found2 = it2 != index2.end();
+        bool typeDiffers = found1 && found2 && arrayType1[it1->second] != arrayType2[it2->second];
 
-        if (arrayType1[ind1] != arrayType2[ind2]) {
+        if (typeDiffers) {
             std::cout << "\033[1;31m";
         }
 
-        if (std::find(arrayList1.begin(), arrayList1.end(), it) != arrayList1.end()) {
-            std::cout <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType1[ind1]] << ") | ";
+        if (found1) {
+            std::cout <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType1[it1->second]] << ") | ";
         } else {
             std::cout <<  std::setw(maxLen) << "" << "        | ";
         }
 
-        if (std::find(arrayList2.begin(), arrayList2.end(), it) != arrayList2.end()) {
-            std::cout <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType2[ind2]] << ") ";
+        if (found2) {
+            std::cout <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType2[it2->second]] << ") ";
         } else {
             std::cout <<  std::setw(maxLen) << "";
         }
 
-        if (arrayType1[ind1] != arrayType2[ind2]) {
+        if (typeDiffers) {
             std::cout << " !" << "\033[0m";
         }
 
@@ -1099,10 +1155,13 @@ void ECLRegressionTest::printMissingKeywords(const std::vector<std::string>& arr
         commonList.insert(key);
     }
 
+    const std::unordered_set<std::string> keywordSet1(arrayList1.begin(), arrayList1.end());
+    const std::unordered_set<std::string> keywordSet2(arrayList2.begin(), arrayList2.end());
+
     std::cout << "\nKeywords found in second case, but missing in first case: \n" << std::endl;
 
     for (auto& it : commonList) {
-        if (std::find(arrayList1.begin(), arrayList1.end(), it) == arrayList1.end()) {
+        if (keywordSet1.count(it) == 0) {
             std::cout << "  > '" << it  << "'" << std::endl;
         }
     }
@@ -1110,7 +1169,7 @@ void ECLRegressionTest::printMissingKeywords(const std::vector<std::string>& arr
     std::cout << "\nKeywords found in first case, but missing in second case: \n" << std::endl;
 
     for (auto& it : commonList) {
-        if (std::find(arrayList2.begin(), arrayList2.end(), it) == arrayList2.end()) {
+        if (keywordSet2.count(it) == 0) {
             std::cout << "  > '" << it  << "'" << std::endl;
         }
     }
@@ -1139,16 +1198,19 @@ void ECLRegressionTest::printComparisonForKeywordLists(const std::vector<std::st
 
     maxLen += 2;
 
+    const std::unordered_set<std::string> keywordSet1(arrayList1.begin(), arrayList1.end());
+    const std::unordered_set<std::string> keywordSet2(arrayList2.begin(), arrayList2.end());
+
     std::cout << std::endl;
 
     for (auto& it : commonList) {
-        if (std::find(arrayList1.begin(), arrayList1.end(), it) != arrayList1.end()) {
+        if (keywordSet1.count(it) > 0) {
             std::cout <<  std::setw(maxLen) << it  << " | ";
         } else {
             std::cout <<  std::setw(maxLen) << "" << " | ";
         }
 
-        if (std::find(arrayList2.begin(), arrayList2.end(), it) != arrayList2.end()) {
+        if (keywordSet2.count(it) > 0) {
             std::cout <<  std::setw(maxLen) << it << "";
         } else {
             std::cout <<  std::setw(maxLen) << "" ;
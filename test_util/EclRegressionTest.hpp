@@ -98,8 +98,6 @@ public:
 private:
     bool checkFileName(const std::string& rootName, const std::string& extension, std::string& filename);
 
-    // Prints results stored in absDeviation and relDeviation.
-    void printResultsForKeyword(const std::string& keyword) const;
     void printComparisonForKeywordLists(const std::vector<std::string>& arrayList1,
                                         const std::vector<std::string>& arrayList2) const;
 
@@ -132,7 +130,7 @@ private:
     // deviationsForCell throws an exception if both the absolute deviation AND the relative deviation
     // are larger than absTolerance and relTolerance, respectively. In addition,
     // if allowNegativeValues is passed as false, an exception will be thrown when the absolute value
-    // of a negative value exceeds absTolerance. If no exceptions are thrown, the absolute and relative deviations are added to absDeviation and relDeviation.
+    // of a negative value exceeds absTolerance.
     // void deviationsForCell(double val1, double val2, const std::string& keyword, const std::string reference, size_t kw_size, size_t cell, bool allowNegativeValues = true);
 
     void deviationsForCell(double val1, double val2, const std::string& keyword,
@@ -144,9 +142,6 @@ private:
                                         const std::string& reference,
                                         size_t kw_size, size_t cell);
 
-    // These vectors store absolute and relative deviations, respecively. Note that they are whiped clean for every new keyword comparison.
-    std::vector<double> absDeviation, relDeviation;
-
     // Keywords which should not contain negative values, i.e. uses allowNegativeValues = false in deviationsForCell():
     const std::vector<std::string> keywordDisallowNegatives = {"SGAS", "SWAT", "PRESSURE"};
 
@@ -0,0 +1,142 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "EclRegressionTest.hpp"
+
+#include <opm/io/eclipse/EclOutput.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+  Benchmark for the regression comparator: two cases with INIT and
+  UNRST files are generated in the current directory, where the second
+  case differs from the first by less than the tolerances. The cases
+  are then compared with results_init() and results_rst(), as compareECL
+  does, and the files are removed again. The timings are written to
+  stderr, after the comparator output.
+
+    compareECLbench [num_cells] [num_steps]
+*/
+
+namespace {
+
+using Opm::EclIO::EclOutput;
+
+const std::vector<std::string> initKeys = {"PORO", "SWL", "SWCR", "SOWCR", "SGU", "KRW", "KRO", "PCW"};
+const std::vector<std::string> solutionKeys = {"PRESSURE", "SWAT", "SGAS", "RS"};
+
+
+float cellValue(std::size_t key, std::size_t cell, std::size_t step, bool perturbed) {
+    const float value = 100.0f * (key + 1) + 50.0f * std::sin(0.001f * cell + 0.1f * step);
+    return perturbed ? value * (1.0f + 1.0e-5f) : value;
+}
+
+
+std::vector<int> intehead(std::size_t num_cells, std::size_t step) {
+    std::vector<int> ih(100, 0);
+    ih[8] = static_cast<int>(num_cells);
+    ih[9] = 1;
+    ih[10] = 1;
+    ih[64] = 1;
+    ih[65] = 1 + step % 12;
+    ih[66] = 2000 + static_cast<int>(step / 12);
+    return ih;
+}
+
+
+void makeCase(const std::string& basename, std::size_t num_cells, std::size_t num_steps, bool perturbed) {
+    std::vector<float> data(num_cells);
+    {
+        EclOutput init(basename + ".INIT", false);
+        init.write("INTEHEAD", intehead(num_cells, 0));
+        for (std::size_t key = 0; key < initKeys.size(); key++) {
+            for (std::size_t cell = 0; cell < num_cells; cell++)
+                data[cell] = cellValue(key, cell, 0, perturbed);
+            init.write(initKeys[key], data);
+        }
+    }
+
+    EclOutput rst(basename + ".UNRST", false);
+    for (std::size_t step = 0; step < num_steps; step++) {
+        rst.write("SEQNUM", std::vector<int>{static_cast<int>(step)});
+        rst.write("INTEHEAD", intehead(num_cells, step));
+        rst.write("DOUBHEAD", std::vector<double>{30.0 * step});
+        rst.write("STARTSOL", std::vector<char>());
+        for (std::size_t key = 0; key < solutionKeys.size(); key++) {
+            for (std::size_t cell = 0; cell < num_cells; cell++)
+                data[cell] = cellValue(key, cell, step, perturbed);
+            rst.write(solutionKeys[key], data);
+        }
+        rst.write("ENDSOL", std::vector<char>());
+    }
+}
+
+
+template <typename Function>
+void timeit(const std::string& name, std::size_t num_values, Function function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    std::cerr << name << ": " << seconds << " s (" << 1e9 * seconds / num_values << " ns/value)" << std::endl;
+}
+
+}
+
+
+int main(int argc, char** argv) {
+    const std::size_t num_cells = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    const std::size_t num_steps = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 10;
+    if (num_cells == 0 || num_steps == 0) {
+        std::cerr << "usage: compareECLbench [num_cells] [num_steps] - both arguments must be positive" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::string case1 = "COMPAREECLBENCH1";
+    const std::string case2 = "COMPAREECLBENCH2";
+    timeit("generate    ", 2 * num_cells * (initKeys.size() + num_steps * solutionKeys.size()), [&]() {
+        makeCase(case1, num_cells, num_steps, false);
+        makeCase(case2, num_cells, num_steps, true);
+    });
+
+    int status = EXIT_SUCCESS;
+    try {
+        ECLRegressionTest init(case1, case2, 1e-3, 1e-3);
+        timeit("results_init", num_cells * initKeys.size(), [&]() { init.results_init(); });
+
+        ECLRegressionTest rst(case1, case2, 1e-3, 1e-3);
+        timeit("results_rst ", num_cells * num_steps * solutionKeys.size(), [&]() { rst.results_rst(); });
+    } catch (const std::exception& e) {
+        std::cerr << "comparison failed: " << e.what() << std::endl;
+        status = EXIT_FAILURE;
+    }
+
+    for (const auto& basename : {case1, case2}) {
+        std::remove((basename + ".INIT").c_str());
+        std::remove((basename + ".UNRST").c_str());
+    }
+
+    return status;
+}
@@ -1,19 +1,89 @@
 #include <chrono>
+#include <exception>
 #include <iomanip>
 #include <iostream>
+#include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 
 using namespace Opm::EclIO;
 
-template<typename T>
-void write(EclOutput& outFile, EclFile& file1,
-           const std::string& name, int index)
+/*
+  The file is converted one array at a time; the array is moved out of
+  the EclFile object and the data held by EclFile is released immediately,
+  so that at most two arrays are held in memory at any time.
+*/
+
+struct EclArray {
+    std::string name;
+    eclArrType arrType;
+    std::vector<int> inteData;
+    std::vector<float> realData;
+    std::vector<double> doubData;
+    std::vector<bool> logiData;
+    std::vector<std::string> charData;
+};
+
+
+class ConvertFile : public EclFile
 {
-    auto vect = file1.get<T>(index);
-    outFile.write(name, vect);
+public:
+    explicit ConvertFile(const std::string& filename) : EclFile(filename) {}
+
+    // Returns false if the array is of an unknown type.
+    bool loadArray(const EclEntry& entry, int index, EclArray& array)
+    {
+        array = EclArray();
+        array.name = std::get<0>(entry);
+        array.arrType = std::get<1>(entry);
+
+        if (array.arrType == INTE) {
+            get<int>(index);
+            array.inteData = std::move(inte_array.at(index));
+        } else if (array.arrType == REAL) {
+            get<float>(index);
+            array.realData = std::move(real_array.at(index));
+        } else if (array.arrType == DOUB) {
+            get<double>(index);
+            array.doubData = std::move(doub_array.at(index));
+        } else if (array.arrType == LOGI) {
+            get<bool>(index);
+            array.logiData = std::move(logi_array.at(index));
+        } else if (array.arrType == CHAR) {
+            get<std::string>(index);
+            array.charData = std::move(char_array.at(index));
+        } else if (array.arrType == MESS) {
+            // should not be any associated data
+            return true;
+        } else {
+            return false;
+        }
+
+        unloadData(index);
+        return true;
+    }
+};
+
+
+static void writeArray(EclOutput& outFile, const EclArray& array)
+{
+    if (array.arrType == INTE) {
+        outFile.write(array.name, array.inteData);
+    } else if (array.arrType == REAL) {
+        outFile.write(array.name, array.realData);
+    } else if (array.arrType == DOUB) {
+        outFile.write(array.name, array.doubData);
+    } else if (array.arrType == LOGI) {
+        outFile.write(array.name, array.logiData);
+    } else if (array.arrType == CHAR) {
+        outFile.write(array.name, array.charData);
+    } else if (array.arrType == MESS) {
+        outFile.write(array.name, std::vector<char>());
+    }
 }
 
 
@@ -24,16 +94,10 @@ int main(int argc, char **argv) {
        exit(1);
     }
 
-    // start reading
     auto start = std::chrono::system_clock::now();
     std::string filename = argv[1];
 
-    EclFile file1(filename);
-
-    file1.loadData();
-
-    auto end1 = std::chrono::system_clock::now();
-    std::chrono::duration<double> elapsed_seconds1 = end1 - start;
+    ConvertFile file1(filename);
 
     bool formattedOutput = file1.formattedInput() ? false : true;
 
@@ -56,34 +120,61 @@ int main(int argc, char **argv) {
 
     auto arrayList = file1.getList();
 
-    for (size_t index = 0; index < arrayList.size(); index++) {
-        std::string name = std::get<0>(arrayList[index]);
-        eclArrType arrType = std::get<1>(arrayList[index]);
-
-        if (arrType == INTE) {
-            write<int>(outFile, file1, name, index);
-        } else if (arrType == REAL) {
-            write<float>(outFile, file1, name,index);
-        } else if (arrType == DOUB) {
-            write<double>(outFile, file1, name, index);
-        } else if (arrType == LOGI) {
-            write<bool>(outFile, file1, name, index);
-        } else if (arrType == CHAR) {
-            write<std::string>(outFile, file1, name, index);
-        } else if (arrType == MESS) {
-            // shold not be any associated data
-            outFile.write(name,std::vector<char>());
-        } else {
-            std::cout << "unknown array type " << std::endl;
-            exit(1);
+    /*
+      Reading array index + 1 runs in parallel with writing array index,
+      using two buffers in turn.
+    */
+    EclArray buffers[2];
+    bool knownType = true;
+    if (!arrayList.empty()) {
+        knownType = file1.loadArray(arrayList[0], 0, buffers[0]);
+    }
+
+    for (size_t index = 0; index < arrayList.size() && knownType; index++) {
+        EclArray& current = buffers[index % 2];
+        EclArray& next = buffers[(index + 1) % 2];
+        std::exception_ptr loadError, writeError;
+
+#pragma omp parallel sections num_threads(2)
+        {
+#pragma omp section
+            {
+                try {
+                    if (index + 1 < arrayList.size()) {
+                        knownType = file1.loadArray(arrayList[index + 1], index + 1, next);
+                    }
+                } catch (...) {
+                    loadError = std::current_exception();
+                }
+            }
+#pragma omp section
+            {
+                try {
+                    writeArray(outFile, current);
+                } catch (...) {
+                    writeError = std::current_exception();
+                }
+            }
         }
+
+        if (writeError) {
+            std::rethrow_exception(writeError);
+        }
+
+        if (loadError) {
+            std::rethrow_exception(loadError);
+        }
+    }
+
+    if (!knownType) {
+        std::cout << "unknown array type " << std::endl;
+        exit(1);
     }
 
-    auto end2 = std::chrono::system_clock::now();
-    std::chrono::duration<double> elapsed_seconds2 = end2-end1;
+    auto end = std::chrono::system_clock::now();
+    std::chrono::duration<double> elapsed_seconds = end - start;
 
-    std::cout << "\ntime to load from file : " << argv[1] << ": " << elapsed_seconds1.count() << " seconds" << std::endl;
-    std::cout << "time to write to file  : " << resFile << ": " << elapsed_seconds2.count() << " seconds\n" << std::endl;
+    std::cout << "\ntime to convert file : " << argv[1] << ": " << elapsed_seconds.count() << " seconds\n" << std::endl;
 
     return 0;
 }
@@ -189,3 +189,39 @@ BOOST_AUTO_TEST_CASE(BoxNineArg) {
     // K2 >= Nz
     BOOST_CHECK_THROW( Opm::Box(nx,ny,nz,1,1,2,2,3,nz), std::invalid_argument);
 }
+
+
+BOOST_AUTO_TEST_CASE(BoxRuns) {
+    Opm::Box globalBox( 10,10,10 );
+    Opm::Box subBox(globalBox , 1,3,1,4,1,5);
+
+    BOOST_CHECK_EQUAL( 20U , subBox.numRuns() );
+    BOOST_CHECK_EQUAL( 3U , subBox.runLength() );
+
+    const auto& indexList = subBox.getIndexList();
+    size_t d = 0;
+    for (size_t run = 0; run < subBox.numRuns(); run++) {
+        for (size_t i = 0; i < subBox.runLength(); i++) {
+            BOOST_CHECK_EQUAL( indexList[d] , subBox.runStart(run) + i );
+            d++;
+        }
+    }
+    BOOST_CHECK_EQUAL( d , subBox.size() );
+
+    BOOST_CHECK_EQUAL( 100U , globalBox.numRuns() );
+    BOOST_CHECK_EQUAL( 990U , globalBox.runStart(99) );
+}
+
+
+BOOST_AUTO_TEST_CASE(CopyBoxIndexList) {
+    Opm::Box globalBox( 10,10,10 );
+    Opm::Box subBox(globalBox , 1,3,1,4,1,5);
+    Opm::Box copy( subBox );
+
+    BOOST_CHECK( copy.equal( subBox ));
+    BOOST_CHECK( copy.getIndexList() == subBox.getIndexList() );
+
+    copy = globalBox;
+    BOOST_CHECK_EQUAL( 1000U , copy.getIndexList().size() );
+    BOOST_CHECK_EQUAL( 60U , subBox.getIndexList().size() );
+}
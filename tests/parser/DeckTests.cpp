@@ -18,6 +18,7 @@
  */
 
 
+#include <future>
 #include <stdexcept>
 #include <sstream>
 
@@ -370,6 +371,30 @@ BOOST_AUTO_TEST_CASE(GetSIMultipleDim) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(GetSIConcurrent) {
+    DeckItem item( "HEI", double() );
+    Dimension dim{ "Length" , 100 };
+
+    item.push_back( 1.0, 10000 );
+    item.push_backDimension( dim , dim );
+
+    const auto& constItem = item;
+    std::vector< std::future< const std::vector< double >* > > tasks;
+    for (int i = 0; i < 8; i++)
+        tasks.push_back( std::async( std::launch::async, [&constItem]() { return &constItem.getSIDoubleData(); } ));
+
+    const auto* si = &constItem.getSIDoubleData();
+    for (auto& task : tasks)
+        BOOST_CHECK_EQUAL( si , task.get() );
+
+    BOOST_CHECK_EQUAL( si->size() , 10000U );
+    BOOST_CHECK_EQUAL( (*si)[9999] , 100 );
+
+    const DeckItem copy( item );
+    BOOST_CHECK( &copy.getSIDoubleData() != si );
+    BOOST_CHECK_EQUAL( copy.getSIDouble( 9999 ) , 100 );
+}
+
 BOOST_AUTO_TEST_CASE(HasValue) {
     DeckItem deckIntItem( "TEST", int() );
     BOOST_CHECK_EQUAL( false , deckIntItem.hasValue(0) );
@@ -710,6 +710,33 @@ BOOST_AUTO_TEST_CASE(ResetACTNUM) {
 }
 
 
+BOOST_AUTO_TEST_CASE(SharedGridStorage) {
+    Opm::EclipseGrid grid( 10 , 10 , 10 );
+    Opm::EclipseGrid copy( grid );
+    BOOST_CHECK_EQUAL( grid.c_ptr() , copy.c_ptr() );
+    BOOST_CHECK_EQUAL( &grid.activeIndexMap() , &copy.activeIndexMap() );
+
+    std::vector<int> actnum(1000, 1);
+    actnum[0] = 0;
+    actnum[500] = 0;
+    copy.resetACTNUM( actnum.data() );
+    BOOST_CHECK( grid.c_ptr() != copy.c_ptr() );
+    BOOST_CHECK( &grid.activeIndexMap() != &copy.activeIndexMap() );
+
+    BOOST_CHECK_EQUAL( grid.getNumActive() , 1000U );
+    BOOST_CHECK( grid.cellActive( 0 ) );
+    BOOST_CHECK_EQUAL( grid.activeIndex( 500 ) , 500U );
+
+    BOOST_CHECK_EQUAL( copy.getNumActive() , 998U );
+    BOOST_CHECK( !copy.cellActive( 0 ) );
+    BOOST_CHECK( !copy.cellActive( 0 , 0 , 5 ) );
+    BOOST_CHECK_THROW( copy.activeIndex( 500 ) , std::invalid_argument );
+    BOOST_CHECK_EQUAL( copy.activeIndex( 501 ) , 499U );
+    BOOST_CHECK_EQUAL( copy.getGlobalIndex( 499 ) , 501U );
+    BOOST_CHECK_EQUAL( copy.getGlobalIndex( 0 ) , 1U );
+    BOOST_CHECK_THROW( copy.getGlobalIndex( 998 ) , std::invalid_argument );
+}
+
 BOOST_AUTO_TEST_CASE(ACTNUM_BEST_EFFORT) {
     const char* deckData1 =
         "RUNSPEC\n"
@@ -1119,6 +1146,44 @@ BOOST_AUTO_TEST_CASE(ZcornMapper) {
 
 
 
+BOOST_AUTO_TEST_CASE(ZcornFixupLarge) {
+    const int nx = 17;
+    const int ny = 12;
+    const int nz = 11;
+    Opm::EclipseGrid grid(nx,ny,nz);
+    Opm::ZcornMapper zmp = grid.zcornMapper( );
+
+    std::vector<double> zcorn;
+    BOOST_CHECK_EQUAL( grid.exportZCORN( zcorn ) , 0U );
+
+    /* Scramble the z values and fix them up again with a plain sequential reference. */
+    for (size_t index = 0; index < zcorn.size(); index++)
+        zcorn[index] += ((index * 7919) % 13) * 0.2 - 1.2;
+
+    auto expected = zcorn;
+    size_t expected_adjusted = 0;
+    for (int j=0; j < ny; j++)
+        for (int i=0; i < nx; i++)
+            for (int c=0; c < 4; c++)
+                for (int k=0; k < nz; k++) {
+                    if (k > 0 && expected[zmp.index(i,j,k,c)] < expected[zmp.index(i,j,k-1,c+4)]) {
+                        expected[zmp.index(i,j,k,c)] = expected[zmp.index(i,j,k-1,c+4)];
+                        expected_adjusted++;
+                    }
+                    if (expected[zmp.index(i,j,k,c+4)] < expected[zmp.index(i,j,k,c)]) {
+                        expected[zmp.index(i,j,k,c+4)] = expected[zmp.index(i,j,k,c)];
+                        expected_adjusted++;
+                    }
+                }
+
+    BOOST_CHECK( expected_adjusted > 0 );
+    BOOST_CHECK( !zmp.validZCORN( zcorn ));
+    BOOST_CHECK_EQUAL( zmp.fixupZCORN( zcorn ) , expected_adjusted );
+    BOOST_CHECK( zmp.validZCORN( zcorn ));
+    BOOST_CHECK( zcorn == expected );
+}
+
+
 BOOST_AUTO_TEST_CASE(MoveTest) {
     int nx = 3;
     int ny = 4;
@@ -1415,6 +1480,29 @@ BOOST_AUTO_TEST_CASE(RadialDetails) {
 }
 
 
+BOOST_AUTO_TEST_CASE(BatchCellGeometry) {
+    Opm::EclipseGrid radial( radial_details() );
+    Opm::EclipseGrid cartesian( 4 , 3 , 2 , 10 , 20 , 5 );
+
+    for (const auto* grid : {&radial , &cartesian}) {
+        const auto geometry = grid->getCellGeometry();
+        BOOST_CHECK_EQUAL( geometry.volume.size() , grid->getCartesianSize() );
+        BOOST_CHECK( grid->getCellVolumes() == geometry.volume );
+        const auto depth = grid->getCellDepths();
+
+        for (size_t g = 0; g < grid->getCartesianSize(); g++) {
+            const auto center = grid->getCellCenter( g );
+            BOOST_CHECK_CLOSE( geometry.volume[g] , grid->getCellVolume( g ) , 1e-8 );
+            BOOST_CHECK_SMALL( geometry.center_x[g] - center[0] , 1e-8 );
+            BOOST_CHECK_SMALL( geometry.center_y[g] - center[1] , 1e-8 );
+            BOOST_CHECK_CLOSE( geometry.depth[g] , grid->getCellDepth( g ) , 1e-8 );
+            BOOST_CHECK_CLOSE( depth[g] , grid->getCellDepth( g ) , 1e-8 );
+            BOOST_CHECK_CLOSE( geometry.thickness[g] , grid->getCellThicknes( g ) , 1e-8 );
+        }
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE(CoordMapper) {
     size_t nx = 10;
     size_t ny = 7;
@@ -111,6 +111,25 @@ BOOST_AUTO_TEST_CASE(GetPOROTOPBased) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(MemoryBudget) {
+    auto deck = createDeckTOP();
+    EclipseState state( deck );
+    const Eclipse3DProperties& props = state.get3DProperties();
+
+    const GridProperty<double>& ntg = props.getDoubleGridProperty( "NTG" );
+    const auto usage = props.memoryUsage();
+    BOOST_CHECK( ntg.memoryUsage() >= 1000 * sizeof(double) );
+
+    state.setMemoryBudget( 1 );
+    BOOST_CHECK_EQUAL( props.memoryUsage() , usage );
+
+    BOOST_CHECK( state.enforceMemoryBudget() > 0 );
+    BOOST_CHECK( props.memoryUsage() < usage );
+    BOOST_CHECK( ntg.memoryUsage() < 1000 * sizeof(double) );
+    BOOST_CHECK_EQUAL( 1.0 , ntg.iget(0) );
+    BOOST_CHECK_EQUAL( state.enforceMemoryBudget() , 0U );
+}
+
 static Deck createDeck() {
 const char *deckData =
 "RUNSPEC\n"
@@ -317,6 +336,29 @@ BOOST_AUTO_TEST_CASE(GetFaults) {
 }
 
 
+BOOST_AUTO_TEST_CASE(ParallelInit) {
+    auto deck = createDeck();
+    ParseContext parseContext;
+    ErrorGuard errors;
+    EclipseState seq_state( deck, parseContext, errors, false );
+    EclipseState par_state( deck, parseContext, errors, true );
+
+    BOOST_CHECK( seq_state.getInputGrid().equal( par_state.getInputGrid() ));
+    BOOST_CHECK_EQUAL( seq_state.runspec().phases().size(), par_state.runspec().phases().size() );
+    BOOST_CHECK_EQUAL( seq_state.getTitle(), par_state.getTitle() );
+    BOOST_CHECK_EQUAL( seq_state.getInputNNC().numNNC(), par_state.getInputNNC().numNNC() );
+
+    const auto& seq_satnum = seq_state.get3DProperties().getIntGridProperty( "SATNUM" ).getData();
+    const auto& par_satnum = par_state.get3DProperties().getIntGridProperty( "SATNUM" ).getData();
+    BOOST_CHECK( seq_satnum == par_satnum );
+
+    const auto& seq_mult = seq_state.getTransMult();
+    const auto& par_mult = par_state.getTransMult();
+    for (size_t g = 0; g < 1000; g++)
+        BOOST_CHECK_EQUAL( seq_mult.getMultiplier( g, FaceDir::XPlus ), par_mult.getMultiplier( g, FaceDir::XPlus ));
+}
+
+
 BOOST_AUTO_TEST_CASE(FaceTransMults) {
     auto deck = createDeckNoFaults();
     EclipseState state(deck);
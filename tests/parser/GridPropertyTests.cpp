@@ -570,3 +570,157 @@ BOOST_AUTO_TEST_CASE(hasKeyword_assertKeyword) {
 
     BOOST_CHECK_THROW( gridProperties.getKeyword( "NOT-SUPPORTED" ), std::invalid_argument );
 }
+
+
+BOOST_AUTO_TEST_CASE(MemoryBudget) {
+    typedef Opm::GridProperties<double>::SupportedKeywordInfo SupportedKeywordInfo;
+    auto ramp = [](size_t size) {
+        std::vector<double> values(size);
+        for (size_t g = 0; g < size; g++)
+            values[g] = g;
+        return values;
+    };
+    std::vector<SupportedKeywordInfo> supportedKeywords = {
+        SupportedKeywordInfo("SWL" , 0.25, "1", true),
+        SupportedKeywordInfo("SWU" , ramp, "1", true),
+        SupportedKeywordInfo("SWCR", ramp, "1", true),
+        SupportedKeywordInfo("PORO", 0.10, "1", true)
+    };
+    const Opm::EclipseGrid grid(10, 10, 10);
+    Opm::UnitSystem unit_system(Opm::UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    Opm::GridProperties<double> gridProperties( grid, &unit_system, std::move( supportedKeywords ) );
+    const size_t property_size = 1000 * sizeof(double);
+    const size_t constant_size = sizeof(size_t) + sizeof(double);
+
+    auto& poro = gridProperties.getOrCreateProperty("PORO");
+    poro.iset(0, 0.20);
+    gridProperties.setMemoryBudget( property_size + constant_size );
+    const auto& properties = gridProperties;
+
+    // The const accessors never release anything.
+    const auto& swl = properties.getKeyword("SWL");
+    const auto& swu = properties.getKeyword("SWU");
+    const auto& swu_data = swu.getData();
+    BOOST_CHECK( !poro.isRegenerable() );
+    BOOST_CHECK( swl.isRegenerable() );
+    BOOST_CHECK_EQUAL( gridProperties.memoryUsage(), 3 * property_size );
+
+    // The modified PORO property does not count against the budget, SWL is the least recently used property.
+    BOOST_CHECK_EQUAL( gridProperties.enforceMemoryBudget(), property_size - constant_size );
+    BOOST_CHECK_EQUAL( gridProperties.memoryUsage(), 2 * property_size + constant_size );
+    BOOST_CHECK_EQUAL( swl.memoryUsage(), constant_size );
+    BOOST_CHECK_EQUAL( swl.iget(999), 0.25 );
+    BOOST_CHECK_EQUAL( swl.memoryUsage(), constant_size );
+    BOOST_CHECK_EQUAL( swl.getCartesianSize(), 1000U );
+    BOOST_CHECK_EQUAL( swu_data[10], 10 );
+    BOOST_CHECK_EQUAL( gridProperties.enforceMemoryBudget(), 0U );
+
+    // Accessing SWL again recreates it. SWU is used after SWCR has been created, and is kept.
+    BOOST_CHECK_EQUAL( properties.getKeyword("SWL").getData()[10], 0.25 );
+    const auto& swcr = properties.getKeyword("SWCR");
+    properties.getKeyword("SWU");
+    BOOST_CHECK_EQUAL( gridProperties.enforceMemoryBudget(), 2 * property_size );
+    BOOST_CHECK_EQUAL( swl.memoryUsage(), constant_size );
+    BOOST_CHECK_EQUAL( swcr.memoryUsage(), 0U );
+    BOOST_CHECK_EQUAL( swu.memoryUsage(), property_size );
+    BOOST_CHECK_EQUAL( gridProperties.memoryUsage(), 2 * property_size + constant_size );
+
+    BOOST_CHECK_EQUAL( swu.iget(10), 10 );
+    BOOST_CHECK_EQUAL( swcr.iget(20), 20 );
+    BOOST_CHECK_EQUAL( poro.iget(0), 0.20 );
+}
+
+
+BOOST_AUTO_TEST_CASE(CompactStorage) {
+    typedef Opm::GridProperty<int>::SupportedKeywordInfo SupportedKeywordInfo;
+    SupportedKeywordInfo keywordInfo("SATNUM" , 1 , "1");
+    Opm::GridProperty<int> satnum( 10 , 10 , 10 , keywordInfo);
+    Opm::GridProperty<int> ramp( 10 , 10 , 10 , keywordInfo);
+    Opm::Box global(10,10,10);
+
+    for (size_t g = 500; g < 1000; g++)
+        satnum.iset(g, 2);
+    for (size_t g = 0; g < 1000; g++)
+        ramp.iset(g, g);
+
+    BOOST_CHECK( satnum.compress() > 0 );
+    BOOST_CHECK( satnum.isCompact() );
+    BOOST_CHECK_EQUAL( ramp.compress(), 0U );
+    BOOST_CHECK( !ramp.isCompact() );
+
+    BOOST_CHECK_EQUAL( satnum.iget(499), 1 );
+    BOOST_CHECK_EQUAL( satnum.iget(500), 2 );
+    BOOST_CHECK_THROW( satnum.iget(1000), std::out_of_range );
+    BOOST_CHECK_EQUAL( satnum.indexEqual(2).size(), 500U );
+
+    std::vector<bool> mask;
+    satnum.initMask(2, mask);
+    BOOST_CHECK( !mask[499] );
+    BOOST_CHECK( mask[500] );
+
+    satnum.scale(3, global);
+    BOOST_CHECK( satnum.isCompact() );
+    BOOST_CHECK_EQUAL( satnum.iget(0), 3 );
+    BOOST_CHECK_EQUAL( satnum.iget(999), 6 );
+
+    // Box operations merge the runs of the box into the property.
+    Opm::Box box(global, 0, 9, 0, 9, 0, 0);
+    satnum.add(1, box);
+    BOOST_CHECK( satnum.isCompact() );
+    BOOST_CHECK_EQUAL( satnum.iget(0), 4 );
+    BOOST_CHECK_EQUAL( satnum.iget(99), 4 );
+    BOOST_CHECK_EQUAL( satnum.iget(100), 3 );
+
+    Opm::Box column(global, 2, 2, 3, 3, 0, 9);
+    satnum.setScalar(7, column);
+    BOOST_CHECK( satnum.isCompact() );
+    BOOST_CHECK_EQUAL( satnum.iget(32), 7 );
+    BOOST_CHECK_EQUAL( satnum.iget(33), 4 );
+    BOOST_CHECK_EQUAL( satnum.iget(932), 7 );
+    BOOST_CHECK_EQUAL( satnum.iget(931), 6 );
+    BOOST_CHECK_EQUAL( satnum.indexEqual(7).size(), 10U );
+    satnum.setScalar(3, column);
+    satnum.setScalar(4, Opm::Box(global, 2, 2, 3, 3, 0, 0));
+    satnum.setScalar(6, Opm::Box(global, 2, 2, 3, 3, 5, 9));
+
+    // getData() expands the property.
+    const auto& const_satnum = satnum;
+    const auto& data = const_satnum.getData();
+    BOOST_CHECK_EQUAL( data.size(), 1000U );
+    BOOST_CHECK_EQUAL( data[99], 4 );
+    BOOST_CHECK_EQUAL( data[999], 6 );
+    BOOST_CHECK( !satnum.isCompact() );
+
+    // The runs are kept for concurrent const readers until the next non-const operation.
+    BOOST_CHECK_EQUAL( satnum.memoryUsage(), 1000 * sizeof(int) + 3 * (sizeof(size_t) + sizeof(int)) );
+    satnum.iset(0, 4);
+    BOOST_CHECK_EQUAL( satnum.memoryUsage(), 1000 * sizeof(int) );
+}
+
+
+BOOST_AUTO_TEST_CASE(LargeBoxOperations) {
+    typedef Opm::GridProperty<double>::SupportedKeywordInfo SupportedKeywordInfo;
+    SupportedKeywordInfo keywordInfo("PORO" , 1.0 , "1");
+    Opm::GridProperty<double> prop( 100 , 100 , 20 , keywordInfo);
+    Opm::GridProperty<double> src( 100 , 100 , 20 , keywordInfo);
+    Opm::Box global(100,100,20);
+    Opm::Box box(global, 10, 89, 0, 99, 1, 19);
+
+    prop.scale(2.0, box);
+    prop.add(0.5, box);
+    src.setScalar(7.0, global);
+
+    for (size_t k = 0; k < 20; k++) {
+        for (size_t j = 0; j < 100; j += 33) {
+            for (size_t i = 0; i < 100; i++) {
+                bool inside = (i >= 10 && i <= 89 && k >= 1);
+                BOOST_CHECK_EQUAL( prop.iget(i,j,k), inside ? 2.5 : 1.0 );
+            }
+        }
+    }
+
+    prop.copyFrom(src, box);
+    BOOST_CHECK_EQUAL( prop.iget(10, 0, 1), 7.0 );
+    BOOST_CHECK_EQUAL( prop.iget(9, 0, 1), 1.0 );
+    BOOST_CHECK_EQUAL( prop.iget(89, 99, 19), 7.0 );
+}
@@ -258,6 +258,34 @@ BOOST_AUTO_TEST_CASE(DefaultedRegions) {
 }
 
 
+BOOST_AUTO_TEST_CASE(BatchRegionMultipliers) {
+  Opm::Deck deck = createDefaultedRegions();
+  Opm::TableManager tm(deck);
+  Opm::EclipseGrid eg( deck );
+  Opm::Eclipse3DProperties props(deck, tm, eg);
+  Opm::MULTREGTScanner scanner(props, deck.getKeywordList("MULTREGT"));
+
+  std::vector<size_t> cells1;
+  std::vector<size_t> cells2;
+  for (size_t g1 = 0; g1 < eg.getCartesianSize(); g1++) {
+      for (size_t g2 = 0; g2 < eg.getCartesianSize(); g2++) {
+          cells1.push_back(g1);
+          cells2.push_back(g2);
+      }
+  }
+
+  for (auto faceDir : {Opm::FaceDir::XPlus, Opm::FaceDir::YMinus, Opm::FaceDir::ZPlus}) {
+      const auto multipliers = scanner.getRegionMultipliers(cells1, cells2, faceDir);
+      BOOST_CHECK_EQUAL(multipliers.size(), cells1.size());
+      for (size_t index = 0; index < cells1.size(); index++)
+          BOOST_CHECK_EQUAL(multipliers[index], scanner.getRegionMultiplier(cells1[index], cells2[index], faceDir));
+  }
+
+  BOOST_CHECK_EQUAL(scanner.getRegionMultipliers({eg.getGlobalIndex(0,0,1)}, {eg.getGlobalIndex(1,0,1)}, Opm::FaceDir::XPlus)[0], 1.25);
+  BOOST_CHECK_THROW(scanner.getRegionMultipliers(cells1, {0}, Opm::FaceDir::XPlus), std::invalid_argument);
+}
+
+
 
 
 static Opm::Deck createCopyMULTNUMDeck() {
@@ -28,6 +28,7 @@
 
 // generic table classes
 #include <opm/parser/eclipse/EclipseState/Tables/SimpleTable.hpp>
+#include <opm/parser/eclipse/EclipseState/Tables/PvtxEvaluator.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/PvtxTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/TableManager.hpp>
 
@@ -127,6 +128,7 @@ BOOST_AUTO_TEST_CASE( PVTOSaturatedTable ) {
     const auto& saturatedTable = pvtoTable.getSaturatedTable( );
     BOOST_CHECK_EQUAL( saturatedTable.numColumns( ) , 4 );
     BOOST_CHECK_EQUAL( saturatedTable.numRows( ) , 2 );
+    BOOST_CHECK( saturatedTable.packedData( ) != nullptr );
 
     BOOST_CHECK_EQUAL( saturatedTable.get(0 , 0) , 20.59 );
     BOOST_CHECK_EQUAL( saturatedTable.get(0 , 1) , 28.19 );
@@ -135,6 +137,8 @@ BOOST_AUTO_TEST_CASE( PVTOSaturatedTable ) {
         int num = 0;
         UnitSystem units( UnitSystem::UnitType::UNIT_TYPE_METRIC );
         for (const auto& table :  pvtoTable) {
+            BOOST_CHECK( table.packedData( ) != nullptr );
+            BOOST_CHECK( table.getColumn( 1 ).begin( ) == table.packedData( ) + table.numRows( ) );
             if (num == 0) {
                 {
                     const auto& col = table.getColumn(0);
@@ -173,11 +177,56 @@ BOOST_AUTO_TEST_CASE( PVTGSaturatedTable ) {
     const auto& saturatedTable = pvtgTable.getSaturatedTable( );
     BOOST_CHECK_EQUAL( saturatedTable.numColumns( ) , 4 );
     BOOST_CHECK_EQUAL( saturatedTable.numRows( ) , 2 );
+    BOOST_CHECK( saturatedTable.packedData( ) != nullptr );
 
     BOOST_CHECK_EQUAL( saturatedTable.get(1 , 0) , 0.00002448 );
     BOOST_CHECK_EQUAL( saturatedTable.get(1 , 1) , 0.00000628 );
 }
 
+BOOST_AUTO_TEST_CASE( PvtxEvaluatorTest ) {
+    Parser parser;
+    boost::filesystem::path deckFile(prefix() + "TABLES/PVTX1.DATA");
+    auto deck =  parser.parseFile(deckFile.string());
+    Opm::TableManager tables(deck);
+    UnitSystem units( UnitSystem::UnitType::UNIT_TYPE_METRIC );
+
+    {
+        const auto& pvtoTable = tables.getPvtoTables( )[0];
+        const PvtxEvaluator evaluator( pvtoTable );
+        BOOST_CHECK_EQUAL( evaluator.numValueColumns( ) , 2 );
+        BOOST_CHECK_EQUAL( evaluator.valueColumnIndex( "MU" ) , 1 );
+        BOOST_CHECK_THROW( evaluator.valueColumnIndex( "P" ) , std::invalid_argument );
+
+        std::vector<double> rs, p;
+        for (double r = 15; r <= 35; r += 1.7)
+            for (double bar = 40; bar <= 180; bar += 7.3) {
+                rs.push_back( r );
+                p.push_back( units.to_si( UnitSystem::measure::pressure , bar ) );
+            }
+
+        std::vector<double> bo( rs.size() ), mu( rs.size() );
+        evaluator.evaluate( rs.size(), rs.data(), p.data(), bo.data(), mu.data() );
+        for (size_t i = 0; i < rs.size(); i++) {
+            BOOST_CHECK_CLOSE( bo[i] , pvtoTable.evaluate( "BO" , rs[i] , p[i] ) , 1e-10 );
+            BOOST_CHECK_CLOSE( mu[i] , pvtoTable.evaluate( "MU" , rs[i] , p[i] ) , 1e-10 );
+            BOOST_CHECK_EQUAL( bo[i] , evaluator.evaluate( 0 , rs[i] , p[i] ) );
+        }
+    }
+
+    {
+        /* The Rv column of PVTG is decreasing. */
+        const auto& pvtgTable = tables.getPvtgTables( )[0];
+        const PvtxEvaluator evaluator( pvtgTable );
+        for (double bar = 10; bar <= 50; bar += 3.1) {
+            const double pg = units.to_si( UnitSystem::measure::pressure , bar );
+            for (double rv = -0.00001; rv <= 0.00003; rv += 0.0000037) {
+                BOOST_CHECK_CLOSE( evaluator.evaluate( "BG" , pg , rv ) , pvtgTable.evaluate( "BG" , pg , rv ) , 1e-10 );
+                BOOST_CHECK_CLOSE( evaluator.evaluate( "MUG" , pg , rv ) , pvtgTable.evaluate( "MUG" , pg , rv ) , 1e-10 );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE( PVTWTable ) {
     const std::string input = R"(
         RUNSPEC
@@ -28,6 +28,7 @@
 #include <opm/parser/eclipse/Deck/Deck.hpp>
 #include <opm/parser/eclipse/EclipseState/Eclipse3DProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/GridProperty.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/SatfuncPropertyInitializers.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/TableManager.hpp>
 #include <opm/parser/eclipse/Parser/Parser.hpp>
 
@@ -150,3 +151,210 @@ BOOST_AUTO_TEST_CASE(SaturationFunctionFamilyTests) {
     Opm::Eclipse3DProperties propMix( deckMix, tmMix, gridMix );
     BOOST_CHECK_THROW(propMix.getDoubleGridProperty("SGCR") , std::invalid_argument);
 }
+
+
+BOOST_AUTO_TEST_CASE(FusedEndpoints) {
+    const char * deckData =
+        "RUNSPEC\n"
+        "OIL\n"
+        "GAS\n"
+        "WATER\n"
+        "DIMENS\n"
+        " 1 1 3 /\n"
+        "TABDIMS\n"
+        "2 /\n"
+        "ENDSCALE\n"
+        "2* 1 2 /\n"
+        "GRID\n"
+        "DX\n"
+        "3*100 /\n"
+        "DY\n"
+        "3*100 /\n"
+        "DZ\n"
+        "3*10 /\n"
+        "TOPS\n"
+        "1000 /\n"
+        "PORO\n"
+        "3*0.10 /\n"
+        "PROPS\n"
+        "SWOF\n"
+        " .2  .0 1.0 .0\n"
+        " .3  .0  .8 .0\n"
+        " .5  .5  .5 .0\n"
+        " .8  .8  .0 .0\n"
+        " 1.0 1.0 .0 .0 /\n"
+        " .1  .0 1.0 .0\n"
+        " .25 .0  .7 .0\n"
+        " .9  .9  .0 .0 /\n"
+        "SGOF\n"
+        " .0  .0 1.0 .0\n"
+        " .1  .0  .3 .0\n"
+        " .8 1.0  .0 .0 /\n"
+        " .0  .0 1.0 .0\n"
+        " .2  .0  .3 .0\n"
+        " .9 1.0  .0 .0 /\n"
+        "ENPTVD\n"
+        "1000.0 0.10 0.20 1.0 0.0 0.04 1.0 0.18 0.22\n"
+        "1030.0 0.40 0.20 0.7 0.0 0.04 1.0 0.18 0.22 /\n"
+        "REGIONS\n"
+        "SATNUM\n"
+        "1 2 2 /\n";
+
+    Parser parser;
+    const auto deck = parser.parseString(deckData);
+    const TableManager tm(deck);
+    const EclipseGrid grid(deck);
+    const Eclipse3DProperties props(deck, tm, grid);
+
+    const std::vector<std::string> keywords = {"SWL", "SWCR", "ISWL", "SWU", "SGCR"};
+    const auto endpoints = satfuncEndpoints(keywords, 3, &tm, &grid, &props.getIntProperties());
+    BOOST_CHECK_EQUAL(endpoints.size(), keywords.size());
+
+    /* SWL from the ENPTVD table at the cell depths 1005, 1015 and 1025. */
+    BOOST_CHECK_CLOSE(endpoints[0][0], 0.15, 1e-10);
+    BOOST_CHECK_CLOSE(endpoints[0][1], 0.25, 1e-10);
+    BOOST_CHECK_CLOSE(endpoints[0][2], 0.35, 1e-10);
+
+    BOOST_CHECK_CLOSE(endpoints[1][1], 0.20, 1e-10);
+    BOOST_CHECK_CLOSE(endpoints[3][2], 1 - 0.75, 1e-10);
+    BOOST_CHECK_CLOSE(endpoints[4][0], 0.04, 1e-10);
+
+    /* Without IMPTVD the imbibition endpoints come from the saturation tables. */
+    BOOST_CHECK_CLOSE(endpoints[2][0], 0.20, 1e-10);
+
+    for (size_t e = 0; e < keywords.size(); e++) {
+        const auto& data = props.getDoubleGridProperty(keywords[e]).getData();
+        for (size_t cell = 0; cell < 3; cell++)
+            BOOST_CHECK_EQUAL(endpoints[e][cell], data[cell]);
+    }
+
+    BOOST_CHECK_THROW(satfuncEndpoints({"SWL", "PORO"}, 3, &tm, &grid, &props.getIntProperties()), std::invalid_argument);
+}
+
+
+BOOST_AUTO_TEST_CASE(EndpointCache) {
+    const char * deckData =
+        "RUNSPEC\n"
+        "OIL\n"
+        "GAS\n"
+        "WATER\n"
+        "DIMENS\n"
+        " 1 1 3 /\n"
+        "TABDIMS\n"
+        "2 /\n"
+        "ENDSCALE\n"
+        "2* 1 2 /\n"
+        "GRID\n"
+        "DX\n"
+        "3*100 /\n"
+        "DY\n"
+        "3*100 /\n"
+        "DZ\n"
+        "3*10 /\n"
+        "TOPS\n"
+        "1000 /\n"
+        "PORO\n"
+        "3*0.10 /\n"
+        "PROPS\n"
+        "SWOF\n"
+        " .2  .0 1.0 .0\n"
+        " .8  .8  .0 .0\n"
+        " 1.0 1.0 .0 .0 /\n"
+        " .1  .0 1.0 .0\n"
+        " .9  .9  .0 .0 /\n"
+        "SGOF\n"
+        " .0  .0 1.0 .0\n"
+        " .8 1.0  .0 .0 /\n"
+        " .0  .0 1.0 .0\n"
+        " .9 1.0  .0 .0 /\n"
+        "ENPTVD\n"
+        "1000.0 0.10 0.20 1.0 0.0 0.04 1.0 0.18 0.22\n"
+        "1030.0 0.40 0.20 0.7 0.0 0.04 1.0 0.18 0.22 /\n"
+        "REGIONS\n"
+        "SATNUM\n"
+        "1 2 2 /\n";
+
+    Parser parser;
+    const auto deck = parser.parseString(deckData);
+    const TableManager tm(deck);
+    const EclipseGrid grid(deck);
+    const Eclipse3DProperties props(deck, tm, grid);
+
+    const std::vector<std::string> keywords = {"SWL", "ISWL", "SWU", "SGCR", "IKRGR", "IPCG"};
+    const auto endpoints = satfuncEndpoints(keywords, 3, &tm, &grid, &props.getIntProperties());
+
+    /* All the requested keywords are served from one pass over the grid. */
+    SatfuncEndpointCache cache(&tm, &grid, &props.getIntProperties());
+    cache.request({"SWLX-", "ISWL", "SWU", "SGCR", "IKRGR", "IPCGZ", "PORO"});
+    for (size_t e = 0; e < keywords.size(); e++) {
+        const auto values = cache.get(keywords[e], 3);
+        for (size_t cell = 0; cell < 3; cell++)
+            BOOST_CHECK_EQUAL(values[cell], endpoints[e][cell]);
+    }
+    BOOST_CHECK_EQUAL(cache.numPasses(), 1U);
+
+    /* A keyword which has already been handed out is computed on its own. */
+    BOOST_CHECK_EQUAL(cache.get("SWL", 3)[2], endpoints[0][2]);
+    BOOST_CHECK_EQUAL(cache.numPasses(), 2U);
+    BOOST_CHECK_THROW(cache.get("PORO", 3), std::invalid_argument);
+
+    /* A keyword which has not been requested is computed on its own. */
+    cache.get("SOWCR", 3);
+    BOOST_CHECK_EQUAL(cache.numPasses(), 3U);
+
+    /* ENPTVD does not have a KRW column. */
+    BOOST_CHECK_THROW(cache.get("KRW", 3), std::invalid_argument);
+    BOOST_CHECK_THROW(props.getDoubleGridProperty("KRW"), std::invalid_argument);
+
+    for (size_t e = 0; e < keywords.size(); e++) {
+        const auto& data = props.getDoubleGridProperty(keywords[e]).getData();
+        for (size_t cell = 0; cell < 3; cell++)
+            BOOST_CHECK_EQUAL(endpoints[e][cell], data[cell]);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(EndpointCacheErrors) {
+    const char * deckData =
+        "RUNSPEC\n"
+        "OIL\n"
+        "WATER\n"
+        "DIMENS\n"
+        " 1 1 3 /\n"
+        "TABDIMS\n"
+        "1 /\n"
+        "GRID\n"
+        "DX\n"
+        "3*100 /\n"
+        "DY\n"
+        "3*100 /\n"
+        "DZ\n"
+        "3*10 /\n"
+        "TOPS\n"
+        "1000 /\n"
+        "PORO\n"
+        "3*0.10 /\n"
+        "PROPS\n"
+        "SWOF\n"
+        " .2  .0 1.0 .0\n"
+        " .8  .8  .0 .0\n"
+        " 1.0 1.0 .0 .0 /\n";
+
+    Parser parser;
+    const auto deck = parser.parseString(deckData);
+    const TableManager tm(deck);
+    const EclipseGrid grid(deck);
+    const Eclipse3DProperties props(deck, tm, grid);
+
+    /* The gas endpoints of a water-oil deck fail the shared pass. */
+    SatfuncEndpointCache cache(&tm, &grid, &props.getIntProperties());
+    cache.request({"SWL", "SGL"});
+    BOOST_CHECK_THROW(cache.get("SWL", 3), std::runtime_error);
+    BOOST_CHECK_EQUAL(cache.numPasses(), 0U);
+
+    SatfuncEndpointCache waterCache(&tm, &grid, &props.getIntProperties());
+    waterCache.request({"SWL", "SWU"});
+    BOOST_CHECK_EQUAL(waterCache.get("SWL", 3)[0], 0.2);
+    BOOST_CHECK_EQUAL(waterCache.get("SWU", 3)[0], 1.0);
+    BOOST_CHECK_EQUAL(waterCache.numPasses(), 1U);
+}
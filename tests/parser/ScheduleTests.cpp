@@ -37,6 +37,7 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/WellConnections.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/Well2.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Well/WellMatcher.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp>
 
 #include <opm/parser/eclipse/Deck/Deck.hpp>
@@ -3153,6 +3154,39 @@ BOOST_AUTO_TEST_CASE(WellNames) {
 }
 
 
+BOOST_AUTO_TEST_CASE(WellMatcherTest) {
+    WellMatcher wm;
+    wm.addWell("PROD1");
+    wm.addWell("INJ1");
+    wm.addWell("PROD2");
+    wm.addWell("PROD1");
+    BOOST_CHECK_EQUAL(wm.size(), 3);
+    BOOST_CHECK(wm.hasWell("INJ1"));
+    BOOST_CHECK(!wm.hasWell("INJ2"));
+
+    BOOST_CHECK(wm.match("NO_SUCH_WELL").empty());
+    BOOST_CHECK(wm.match("PROD?").empty());
+    BOOST_CHECK(wm.match("PROD1") == std::vector<std::size_t>({0}));
+    BOOST_CHECK(wm.match("*") == std::vector<std::size_t>({0,1,2}));
+    BOOST_CHECK(wm.match("PROD*") == std::vector<std::size_t>({0,2}));
+    BOOST_CHECK(wm.match("P*2") == std::vector<std::size_t>({2}));
+    BOOST_CHECK(wm.match("*1") == std::vector<std::size_t>({0,1}));
+
+    // Wells added after a pattern has been matched must be picked up.
+    wm.addWell("PROD3");
+    wm.addWell("INJ2");
+    BOOST_CHECK(wm.match("PROD*") == std::vector<std::size_t>({0,2,3}));
+    BOOST_CHECK(wm.match("*") == std::vector<std::size_t>({0,1,2,3,4}));
+    BOOST_CHECK(wm.match("I*[12]") == std::vector<std::size_t>({1,4}));
+    BOOST_CHECK(wm.match("INJ2") == std::vector<std::size_t>({4}));
+
+    WellMatcher wm_copy(wm);
+    wm_copy.addWell("PROD4");
+    BOOST_CHECK(wm_copy.match("PROD*") == std::vector<std::size_t>({0,2,3,5}));
+    BOOST_CHECK(wm.match("PROD*") == std::vector<std::size_t>({0,2,3}));
+}
+
+
 
 BOOST_AUTO_TEST_CASE(RFT_CONFIG) {
     TimeMap tm(Opm::TimeMap::mkdate(2010, 1,1));
@@ -85,3 +85,78 @@ BOOST_AUTO_TEST_CASE( CreateTest ) {
     }
 }
 
+
+
+BOOST_AUTO_TEST_CASE( EvaluateTest ) {
+    TableSchema schema;
+    schema.addColumn( ColumnSchema("X" , Table::STRICTLY_INCREASING , Table::DEFAULT_NONE) );
+    schema.addColumn( ColumnSchema("Y" , Table::RANDOM , Table::DEFAULT_NONE) );
+
+    SimpleTable table(schema);
+    table.addRow( {0, 10} );
+    table.addRow( {1, 20} );
+    table.addRow( {3, 0} );
+
+    BOOST_CHECK_EQUAL( table.getColumnIndex("X") , 0U );
+    BOOST_CHECK_EQUAL( table.getColumnIndex("Y") , 1U );
+    BOOST_CHECK_THROW( table.getColumnIndex("Z") , std::invalid_argument );
+
+    const std::vector<double> x = {-1, 0, 0.5, 1, 2, 3, 4};
+    const auto y = table.evaluate("Y" , x);
+    BOOST_CHECK_EQUAL( y.size() , x.size() );
+    for (size_t i = 0; i < x.size(); i++) {
+        BOOST_CHECK_EQUAL( y[i] , table.evaluate("Y" , x[i]) );
+        BOOST_CHECK_EQUAL( y[i] , table.evaluate(1 , x[i]) );
+    }
+    BOOST_CHECK_CLOSE( y[2] , 15 , 1e-12 );
+    BOOST_CHECK_CLOSE( y[4] , 10 , 1e-12 );
+}
+
+
+
+BOOST_AUTO_TEST_CASE( PackTest ) {
+    TableSchema schema;
+    schema.addColumn( ColumnSchema("X" , Table::STRICTLY_INCREASING , Table::DEFAULT_NONE) );
+    schema.addColumn( ColumnSchema("Y" , Table::RANDOM , Table::DEFAULT_NONE) );
+
+    SimpleTable table(schema);
+    table.addRow( {0, 10} );
+    table.addRow( {1, 20} );
+    table.addRow( {3, 0} );
+    BOOST_CHECK( table.packedData() == nullptr );
+
+    table.pack();
+    {
+        const auto& packed = table;
+        const double* data = packed.packedData();
+        BOOST_CHECK( data != nullptr );
+        BOOST_CHECK( packed.getColumn( 0 ).begin() == data );
+        BOOST_CHECK( packed.getColumn( 1 ).begin() == data + 3 );
+        BOOST_CHECK_EQUAL( data[4] , 20 );
+        BOOST_CHECK_EQUAL( packed.getColumn("Y").max() , 20 );
+        BOOST_CHECK_CLOSE( packed.evaluate("Y" , 0.5) , 15 , 1e-12 );
+
+        SimpleTable copy( packed );
+        BOOST_CHECK( copy.packedData() != nullptr );
+        BOOST_CHECK( copy.packedData() != data );
+        for (size_t c = 0; c < 2; c++)
+            for (size_t r = 0; r < 3; r++)
+                BOOST_CHECK_EQUAL( copy.get(c , r) , packed.get(c , r) );
+
+        TableColumn column = packed.getColumn( 1 );
+        BOOST_CHECK( column.begin() != packed.getColumn( 1 ).begin() );
+        BOOST_CHECK_EQUAL( column[2] , 0 );
+    }
+
+    table.addRow( {4, 5} );
+    BOOST_CHECK( table.packedData() == nullptr );
+    BOOST_CHECK_EQUAL( table.numRows() , 4U );
+    BOOST_CHECK_EQUAL( table.get(1 , 1) , 20 );
+    BOOST_CHECK_EQUAL( table.get(1 , 3) , 5 );
+
+    table.pack();
+    table.getColumn( 1 ).updateValue( 3 , 6 );
+    BOOST_CHECK( table.packedData() == nullptr );
+    BOOST_CHECK_EQUAL( table.get(1 , 3) , 6 );
+    BOOST_CHECK_EQUAL( table.get(0 , 3) , 4 );
+}
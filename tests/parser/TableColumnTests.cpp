@@ -21,6 +21,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cmath>
+#include <vector>
 
 #include <opm/parser/eclipse/EclipseState/Tables/TableIndex.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/TableColumn.hpp>
@@ -322,3 +324,69 @@ BOOST_AUTO_TEST_CASE( Test_LINEAR_DEFAULT ) {
     BOOST_CHECK_CLOSE( valueColumn[3] , 1.00 , 1e-6);
     BOOST_CHECK_CLOSE( valueColumn[5] , 0.25 , 1e-6);
 }
+
+
+BOOST_AUTO_TEST_CASE( Test_MIN_MAX_UPDATE ) {
+    ColumnSchema argSchema("ARG" , Table::INCREASING , Table::DEFAULT_NONE);
+    ColumnSchema valueSchema("VALUE" , Table::RANDOM , Table::DEFAULT_LINEAR);
+    TableColumn argColumn( argSchema );
+    TableColumn valueColumn( valueSchema );
+
+    argColumn.addValue( 0 );   valueColumn.addDefault( );
+    argColumn.addValue( 1 );   valueColumn.addValue( 5 );
+    argColumn.addValue( 2 );   valueColumn.addDefault( );
+    argColumn.addValue( 3 );   valueColumn.addValue( -1 );
+    argColumn.addValue( 4 );   valueColumn.addDefault( );
+
+    BOOST_CHECK_THROW( valueColumn.max( ) , std::invalid_argument );
+    valueColumn.applyDefaults( argColumn );
+
+    BOOST_CHECK_EQUAL( valueColumn.max( ) , 5 );
+    BOOST_CHECK_EQUAL( valueColumn.min( ) , -1 );
+
+    valueColumn.updateValue( 2 , 7 );
+    BOOST_CHECK_EQUAL( valueColumn.max( ) , 7 );
+    valueColumn.updateValue( 2 , 2 );
+    BOOST_CHECK_EQUAL( valueColumn.max( ) , 5 );
+    BOOST_CHECK_EQUAL( valueColumn.min( ) , -1 );
+    valueColumn.updateValue( 3 , 4 );
+    BOOST_CHECK_EQUAL( valueColumn.min( ) , -1 );
+    valueColumn.updateValue( 4 , 3 );
+    BOOST_CHECK_EQUAL( valueColumn.min( ) , 2 );
+}
+
+
+BOOST_AUTO_TEST_CASE( Test_LOOKUP_EVAL ) {
+    for (auto order : {Table::INCREASING , Table::DECREASING}) {
+        ColumnSchema argSchema("ARG" , order , Table::DEFAULT_NONE);
+        ColumnSchema valueSchema("VALUE" , Table::RANDOM , Table::DEFAULT_NONE);
+        TableColumn argColumn( argSchema );
+        TableColumn valueColumn( valueSchema );
+
+        const std::vector<double> arg = {0, 0.1, 0.1, 0.35, 0.6, 0.9, 1.0, 1.0};
+        for (size_t i = 0; i < arg.size(); i++) {
+            argColumn.addValue( order == Table::INCREASING ? arg[i] : arg[arg.size() - 1 - i] );
+            valueColumn.addValue( (i * 7919) % 13 / 3.0 );
+        }
+
+        std::vector<double> x;
+        for (int i = -200; i < 30000; i++)
+            x.push_back( 1.2 * std::sin( 0.37 * i ) );
+        for (double a : arg)
+            x.push_back( a );
+        for (int i = -10; i < 120; i++)
+            x.push_back( i / 100.0 );
+
+        std::vector<double> values( x.size() );
+        argColumn.lookupEval( x.data() , x.size() , valueColumn , values.data() );
+
+        for (size_t i = 0; i < x.size(); i++)
+            BOOST_CHECK_EQUAL( values[i] , valueColumn.eval( argColumn.lookup( x[i] )));
+    }
+
+    ColumnSchema randomSchema("RANDOM" , Table::RANDOM , Table::DEFAULT_NONE);
+    TableColumn randomColumn( randomSchema );
+    randomColumn.addValue( 1 );
+    double x = 0, value;
+    BOOST_CHECK_THROW( randomColumn.lookupEval( &x , 1 , randomColumn , &value ) , std::invalid_argument );
+}
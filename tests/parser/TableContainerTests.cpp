@@ -25,6 +25,7 @@
 #include <opm/parser/eclipse/Deck/Deck.hpp>
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/parser/eclipse/Deck/DeckRecord.hpp>
+#include <opm/parser/eclipse/EclipseState/Tables/SimpleTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/TableContainer.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/SwofTable.hpp>
 
@@ -65,3 +66,44 @@ BOOST_AUTO_TEST_CASE( CreateContainer ) {
     BOOST_CHECK_THROW( container[10] , std::invalid_argument );
 }
 
+
+
+BOOST_AUTO_TEST_CASE( PackedTables ) {
+    auto deck = createSWOFDeck();
+    const auto& keyword = deck.getKeyword("SWOF");
+    Opm::TableContainer container(4);
+
+    auto table0 = std::make_shared<Opm::SwofTable>( keyword.getRecord(0).getItem(0), false );
+    auto table1 = std::make_shared<Opm::SwofTable>( keyword.getRecord(1).getItem(0), false );
+    BOOST_CHECK_THROW( container.getPackedTable( 0 ) , std::invalid_argument );
+
+    container.addTable( 2 , table1 );
+    container.addTable( 0 , table0 );
+    BOOST_CHECK( container.hasTable( 0 ));
+    BOOST_CHECK( !container.hasTable( 1 ));
+    BOOST_CHECK_EQUAL( table0.get() , &(container[1]));
+    BOOST_CHECK_EQUAL( table1.get() , &(container[3]));
+
+    for (size_t tableNumber = 0; tableNumber < 4; tableNumber++) {
+        const auto& table = container.getTable( tableNumber );
+        const auto packed = container.getPackedTable( tableNumber );
+        BOOST_CHECK_EQUAL( packed.numRows , table.numRows() );
+        BOOST_CHECK_EQUAL( packed.numColumns , table.numColumns() );
+        BOOST_CHECK( packed.data == table.packedData() );
+        for (size_t c = 0; c < packed.numColumns; c++)
+            for (size_t r = 0; r < packed.numRows; r++)
+                BOOST_CHECK_EQUAL( packed.column(c)[r] , table.get(c , r) );
+    }
+
+    container.addTable( 0 , table1 );
+    BOOST_CHECK_EQUAL( 2 , container.size() );
+    BOOST_CHECK_EQUAL( container.getPackedTable( 1 ).column(0)[0] , 9 );
+    BOOST_CHECK_THROW( container.getPackedTable( 4 ) , std::invalid_argument );
+
+    Opm::TableSchema schema;
+    schema.addColumn( Opm::ColumnSchema("X" , Opm::Table::STRICTLY_INCREASING , Opm::Table::DEFAULT_NONE) );
+    auto table3 = std::make_shared<Opm::SimpleTable>( schema );
+    table3->addRow( {1} );
+    container.addTable( 3 , table3 );
+    BOOST_CHECK_THROW( container.getPackedTable( 3 ) , std::logic_error );
+}
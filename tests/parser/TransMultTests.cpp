@@ -25,6 +25,9 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/parser/eclipse/EclipseState/Eclipse3DProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/TransMult.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/TransMult.hpp>
@@ -44,3 +47,80 @@ BOOST_AUTO_TEST_CASE(Empty) {
     BOOST_CHECK_EQUAL( transMult.getMultiplier(9,9,9, Opm::FaceDir::YMinus) , 1.0 );
     BOOST_CHECK_EQUAL( transMult.getMultiplier(100 , Opm::FaceDir::ZMinus) , 1.0 );
 }
+
+
+BOOST_AUTO_TEST_CASE(FaceMultipliers) {
+    const char* deckData =
+        "RUNSPEC\n"
+        "DIMENS\n"
+        " 3 3 2 /\n"
+        "GRID\n"
+        "DX\n"
+        " 18*1 /\n"
+        "DY\n"
+        " 18*1 /\n"
+        "DZ\n"
+        " 18*1 /\n"
+        "TOPS\n"
+        " 9*1 /\n"
+        "FLUXNUM\n"
+        " 1 1 2  1 1 2  1 1 2\n"
+        " 3 3 3  3 3 3  3 3 3 /\n"
+        "MULTX\n"
+        " 9*2 9*1 /\n"
+        "MULTZ-\n"
+        " 9*1 9*4 /\n"
+        "FAULTS\n"
+        " 'F1'  1  1  1  3  1  2  'X' /\n"
+        " 'F2'  2  2  2  2  1  1  'Y-' /\n"
+        "/\n"
+        "MULTFLT\n"
+        " 'F1'  0.5 /\n"
+        " 'F2'  0.25 /\n"
+        "/\n"
+        "MULTREGT\n"
+        " 1  2  0.10  XYZ /\n"
+        " 1  3  0.20  XYZ /\n"
+        "/\n"
+        "EDIT\n";
+
+    Opm::Parser parser;
+    Opm::EclipseState state(parser.parseString(deckData));
+    const auto& transMult = state.getTransMult();
+    const size_t size = 18;
+
+    const auto multipliers = transMult.getFaceMultipliers();
+    BOOST_CHECK_EQUAL( multipliers.size(), 6 * size );
+
+    for (auto faceDir : {Opm::FaceDir::XPlus, Opm::FaceDir::XMinus,
+                         Opm::FaceDir::YPlus, Opm::FaceDir::YMinus,
+                         Opm::FaceDir::ZPlus, Opm::FaceDir::ZMinus}) {
+        const auto dirMultipliers = transMult.getMultipliers(faceDir);
+        BOOST_CHECK_EQUAL( dirMultipliers.size(), size );
+        for (size_t g = 0; g < size; g++)
+            BOOST_CHECK_EQUAL( dirMultipliers[g], transMult.getMultiplier(g, faceDir) );
+    }
+
+    /* MULTX, the F1 fault and the 1 -> 2 MULTREGT record on the XPlus face. */
+    const auto xplus = multipliers.begin() + Opm::TransMult::faceIndex(Opm::FaceDir::XPlus) * size;
+    BOOST_CHECK_CLOSE( xplus[0], 2 * 0.5, 1e-12 );
+    BOOST_CHECK_CLOSE( xplus[1], 2 * 0.10, 1e-12 );
+    BOOST_CHECK_EQUAL( xplus[2], 2 );
+    BOOST_CHECK_CLOSE( xplus[9], 0.5, 1e-12 );
+    BOOST_CHECK_EQUAL( xplus[10], 1 );
+
+    /* The F2 fault, and no MULTREGT on the minus faces. */
+    const auto yminus = multipliers.begin() + Opm::TransMult::faceIndex(Opm::FaceDir::YMinus) * size;
+    BOOST_CHECK_EQUAL( yminus[4], 0.25 );
+    BOOST_CHECK_EQUAL( yminus[13], 1 );
+
+    /* The 1 -> 3 MULTREGT record between the layers. */
+    const auto zplus = multipliers.begin() + Opm::TransMult::faceIndex(Opm::FaceDir::ZPlus) * size;
+    const auto zminus = multipliers.begin() + Opm::TransMult::faceIndex(Opm::FaceDir::ZMinus) * size;
+    BOOST_CHECK_CLOSE( zplus[0], 0.20, 1e-12 );
+    BOOST_CHECK_EQUAL( zplus[2], 1 );
+    BOOST_CHECK_EQUAL( zplus[9], 1 );
+    BOOST_CHECK_EQUAL( zminus[9], 4 );
+
+    BOOST_CHECK_THROW( Opm::TransMult::faceIndex(static_cast<Opm::FaceDir::DirEnum>(3)), std::invalid_argument );
+}
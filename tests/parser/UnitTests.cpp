@@ -25,8 +25,10 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cmath>
 #include <memory>
 #include <ostream>
+#include <vector>
 
 using namespace Opm;
 
@@ -632,3 +634,52 @@ BOOST_AUTO_TEST_CASE(TemperatureConversions)
     BOOST_CHECK_CLOSE(field.to_si(Meas::temperature , 1.0), (459.67 + 1.0)*5.0/9.0, 1.0e-10);
     BOOST_CHECK_CLOSE(field.from_si(Meas::temperature , (459.67 + 1.0)*5.0/9.0), 1.0, 1.0e-10);
 }
+
+BOOST_AUTO_TEST_CASE(BulkConversions)
+{
+    using Meas = UnitSystem::measure;
+
+    const std::vector<double> input = { -10.0, -0.0, 0.0, 1.0, 3.5, 274.15, 1.0e5, 2.0e7 };
+    for (const auto& units : { UnitSystem::newMETRIC(), UnitSystem::newFIELD(),
+                               UnitSystem::newLAB(), UnitSystem::newPVT_M() }) {
+        for (int m = static_cast<int>(Meas::identity); m <= static_cast<int>(Meas::gas_productivity_index); m++) {
+            const auto meas = static_cast<Meas>(m);
+            const auto to_si = units.to_si_conversion(meas);
+            const auto from_si = units.from_si_conversion(meas);
+
+            std::vector<double> si(input.size()), output(input.size());
+            units.to_si(meas, input.data(), si.data(), input.size());
+            units.from_si(meas, input.data(), output.data(), input.size());
+
+            auto in_place = input;
+            units.to_si(meas, in_place);
+
+            for (size_t i = 0; i < input.size(); i++) {
+                BOOST_CHECK_EQUAL(si[i], units.to_si(meas, input[i]));
+                BOOST_CHECK_EQUAL(output[i], units.from_si(meas, input[i]));
+                BOOST_CHECK_EQUAL(in_place[i], si[i]);
+                BOOST_CHECK_EQUAL(to_si(input[i]), si[i]);
+                BOOST_CHECK_EQUAL(from_si(input[i]), output[i]);
+                BOOST_CHECK_EQUAL(std::signbit(si[i]), std::signbit(units.to_si(meas, input[i])));
+                BOOST_CHECK_EQUAL(std::signbit(output[i]), std::signbit(units.from_si(meas, input[i])));
+            }
+        }
+    }
+
+    /* The conversion from SI does not add an offset after scaling, so -0.0 stays -0.0. */
+    const auto metric = UnitSystem::newMETRIC();
+    BOOST_CHECK(std::signbit(metric.from_si(Meas::pressure, -0.0)));
+    BOOST_CHECK(std::signbit(metric.from_si_conversion(Meas::pressure)(-0.0)));
+
+    /* A large array is converted in place, in parallel if possible. */
+    const auto field = UnitSystem::newFIELD();
+    std::vector<double> temperature(250000);
+    for (size_t i = 0; i < temperature.size(); i++)
+        temperature[i] = 0.001 * i;
+
+    const auto copy = temperature;
+    field.to_si_conversion(Meas::temperature)(temperature.data(), temperature.data(), temperature.size());
+    field.from_si(Meas::temperature, temperature);
+    for (size_t i = 0; i < temperature.size(); i += 1000)
+        BOOST_CHECK_CLOSE(temperature[i] + 1, copy[i] + 1, 1.0e-10);
+}
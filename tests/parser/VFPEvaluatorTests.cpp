@@ -0,0 +1,190 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE VFPEvaluatorTests
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/VFPEvaluator.hpp>
+
+using namespace Opm;
+
+namespace {
+
+const std::vector<double> flo_axis = {10, 50, 100, 400};
+const std::vector<double> thp_axis = {5e5, 2e6, 4e6};
+const std::vector<double> wfr_axis = {0.0, 0.5};
+const std::vector<double> gfr_axis = {10, 100, 150};
+const std::vector<double> alq_axis = {0};
+
+/*
+  A table with bhp = 2*thp + 3e5*wfr + 5e3*gfr + 1e3*flo, which is
+  reproduced exactly by multilinear interpolation.
+*/
+VFPProdTable linearProdTable(VFPProdTable::FLO_TYPE flo_type,
+                             VFPProdTable::WFR_TYPE wfr_type,
+                             VFPProdTable::GFR_TYPE gfr_type) {
+    VFPProdTable::extents shape;
+    shape[0] = thp_axis.size();
+    shape[1] = wfr_axis.size();
+    shape[2] = gfr_axis.size();
+    shape[3] = alq_axis.size();
+    shape[4] = flo_axis.size();
+    VFPProdTable::array_type data(shape);
+
+    for (size_t t = 0; t < thp_axis.size(); t++)
+        for (size_t w = 0; w < wfr_axis.size(); w++)
+            for (size_t g = 0; g < gfr_axis.size(); g++)
+                for (size_t f = 0; f < flo_axis.size(); f++)
+                    data[t][w][g][0][f] = 2*thp_axis[t] + 3e5*wfr_axis[w] + 5e3*gfr_axis[g] + 1e3*flo_axis[f];
+
+    return VFPProdTable(1, 1000, flo_type, wfr_type, gfr_type, VFPProdTable::ALQ_UNDEF,
+                        flo_axis, thp_axis, wfr_axis, gfr_axis, alq_axis, data);
+}
+
+}
+
+
+BOOST_AUTO_TEST_CASE(ProdLinear) {
+    const auto table = linearProdTable(VFPProdTable::FLO_LIQ, VFPProdTable::WFR_WCT, VFPProdTable::GFR_GOR);
+    const VFPProdEvaluator evaluator(table);
+
+    const double wat = 30, oil = 45, gas = 3000, thp = 1e6;
+    const double liq = wat + oil;
+    const auto bhp = evaluator.bhp(wat, oil, gas, thp, 0);
+
+    BOOST_CHECK_CLOSE(bhp.value, 2*thp + 3e5*wat/liq + 5e3*gas/oil + 1e3*liq, 1e-10);
+    BOOST_CHECK_CLOSE(bhp.dpressure, 2, 1e-10);
+    BOOST_CHECK_CLOSE(bhp.dwat, 3e5*oil/(liq*liq) + 1e3, 1e-10);
+    BOOST_CHECK_CLOSE(bhp.doil, -3e5*wat/(liq*liq) - 5e3*gas/(oil*oil) + 1e3, 1e-10);
+    BOOST_CHECK_CLOSE(bhp.dgas, 5e3/oil, 1e-10);
+
+    /* Extrapolation beyond the FLO and THP axes is linear. */
+    const auto extrapolated = evaluator.bhp(300, 500, 1e4, 6e6, 0);
+    BOOST_CHECK_CLOSE(extrapolated.value, 2*6e6 + 3e5*300/800 + 5e3*20 + 1e3*800, 1e-10);
+
+    const auto inverse = evaluator.thp(wat, oil, gas, bhp.value, 0);
+    BOOST_CHECK_CLOSE(inverse.value, thp, 1e-10);
+    BOOST_CHECK_CLOSE(inverse.dpressure, 0.5, 1e-10);
+    BOOST_CHECK_CLOSE(inverse.dwat, -bhp.dwat / 2, 1e-10);
+    BOOST_CHECK_CLOSE(inverse.doil, -bhp.doil / 2, 1e-10);
+    BOOST_CHECK_CLOSE(inverse.dgas, -bhp.dgas / 2, 1e-10);
+
+    /* A zero denominator gives a zero ratio. */
+    const auto no_oil = evaluator.bhp(0, 0, 100, thp, 0);
+    BOOST_CHECK_CLOSE(no_oil.value, 2*thp + 3e5*0 + 5e3*0 + 1e3*0, 1e-10);
+}
+
+
+BOOST_AUTO_TEST_CASE(ProdDerivatives) {
+    VFPProdTable::extents shape;
+    shape[0] = thp_axis.size();
+    shape[1] = wfr_axis.size();
+    shape[2] = gfr_axis.size();
+    shape[3] = alq_axis.size();
+    shape[4] = flo_axis.size();
+    VFPProdTable::array_type data(shape);
+    for (size_t i = 0; i < data.num_elements(); i++)
+        data.data()[i] = 1e7 + 1e6 * std::sin(1.7 * i);
+
+    const VFPProdTable table(2, 1000, VFPProdTable::FLO_GAS, VFPProdTable::WFR_WGR, VFPProdTable::GFR_OGR,
+                             VFPProdTable::ALQ_UNDEF, flo_axis, thp_axis, wfr_axis, gfr_axis, alq_axis, data);
+    const VFPProdEvaluator evaluator(table);
+
+    const double wat = 20, oil = 11000, gas = 120, thp = 1.5e6;
+    const double eps = 1e-3;
+    const auto bhp = evaluator.bhp(wat, oil, gas, thp, 0);
+    const auto dwat = (evaluator.bhp(wat + eps, oil, gas, thp, 0).value - evaluator.bhp(wat - eps, oil, gas, thp, 0).value) / (2*eps);
+    const auto doil = (evaluator.bhp(wat, oil + eps, gas, thp, 0).value - evaluator.bhp(wat, oil - eps, gas, thp, 0).value) / (2*eps);
+    const auto dgas = (evaluator.bhp(wat, oil, gas + eps, thp, 0).value - evaluator.bhp(wat, oil, gas - eps, thp, 0).value) / (2*eps);
+    BOOST_CHECK_CLOSE(bhp.dwat, dwat, 1e-3);
+    BOOST_CHECK_CLOSE(bhp.doil, doil, 1e-3);
+    BOOST_CHECK_CLOSE(bhp.dgas, dgas, 1e-3);
+
+    /* The table values are reproduced at the axis points. */
+    const auto node = evaluator.bhp(0.5 * 100, 100 * 100, 100, thp_axis[2], 0);
+    BOOST_CHECK_CLOSE(node.value, data[2][1][1][0][2], 1e-10);
+
+    /* The batch versions give the same results as the single well versions. */
+    const size_t num_wells = 2500;
+    std::vector<double> w(num_wells), o(num_wells), g(num_wells), p(num_wells), a(num_wells, 0);
+    for (size_t i = 0; i < num_wells; i++) {
+        w[i] = 10 + 0.03 * i;
+        o[i] = 5000 + 10.0 * i;
+        g[i] = 50 + 0.2 * i;
+        p[i] = 1e6 + 1e3 * i;
+    }
+
+    std::vector<VFPEvaluation> bhp_values(num_wells), thp_values(num_wells);
+    evaluator.bhp(num_wells, w.data(), o.data(), g.data(), p.data(), a.data(), bhp_values.data());
+    evaluator.thp(num_wells, w.data(), o.data(), g.data(), p.data(), a.data(), thp_values.data());
+    for (size_t i = 0; i < num_wells; i++) {
+        const auto bhp_single = evaluator.bhp(w[i], o[i], g[i], p[i], 0);
+        const auto thp_single = evaluator.thp(w[i], o[i], g[i], p[i], 0);
+        BOOST_CHECK_EQUAL(bhp_values[i].value, bhp_single.value);
+        BOOST_CHECK_EQUAL(bhp_values[i].doil, bhp_single.doil);
+        BOOST_CHECK_EQUAL(thp_values[i].value, thp_single.value);
+        BOOST_CHECK_EQUAL(thp_values[i].dgas, thp_single.dgas);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(Inj) {
+    VFPInjTable::extents shape;
+    shape[0] = thp_axis.size();
+    shape[1] = flo_axis.size();
+    VFPInjTable::array_type data(shape);
+    for (size_t t = 0; t < thp_axis.size(); t++)
+        for (size_t f = 0; f < flo_axis.size(); f++)
+            data[t][f] = 1.5 * thp_axis[t] + 2e3 * flo_axis[f];
+
+    const VFPInjTable table(3, 1000, VFPInjTable::FLO_WAT, flo_axis, thp_axis, data);
+    const VFPInjEvaluator evaluator(table);
+
+    const auto bhp = evaluator.bhp(75, 1e6, 1e6, 3e6);
+    BOOST_CHECK_CLOSE(bhp.value, 1.5 * 3e6 + 2e3 * 75, 1e-10);
+    BOOST_CHECK_CLOSE(bhp.dpressure, 1.5, 1e-10);
+    BOOST_CHECK_CLOSE(bhp.dwat, 2e3, 1e-10);
+    BOOST_CHECK_EQUAL(bhp.doil, 0);
+    BOOST_CHECK_EQUAL(bhp.dgas, 0);
+
+    const auto thp = evaluator.thp(75, 0, 0, bhp.value);
+    BOOST_CHECK_CLOSE(thp.value, 3e6, 1e-10);
+    BOOST_CHECK_CLOSE(thp.dpressure, 1 / 1.5, 1e-10);
+    BOOST_CHECK_CLOSE(thp.dwat, -2e3 / 1.5, 1e-10);
+
+    const double wat[2] = {10, 500};
+    const double zero[2] = {0, 0};
+    const double bhp_target[2] = {1e6, 1e7};
+    VFPEvaluation thp_values[2];
+    evaluator.thp(2, wat, zero, zero, bhp_target, thp_values);
+    for (size_t i = 0; i < 2; i++)
+        BOOST_CHECK_CLOSE(thp_values[i].value, (bhp_target[i] - 2e3 * wat[i]) / 1.5, 1e-10);
+
+    const std::vector<double> repeated = {5, 5};
+    VFPInjTable::extents bad_shape;
+    bad_shape[0] = 1;
+    bad_shape[1] = 2;
+    const VFPInjTable bad(4, 1000, VFPInjTable::FLO_WAT, repeated, {1e6}, VFPInjTable::array_type(bad_shape));
+    BOOST_CHECK_THROW(VFPInjEvaluator{bad}, std::invalid_argument);
+}
@@ -0,0 +1,113 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE ActiveIndexMapTest
+#include <boost/test/unit_test.hpp>
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <opm/common/utility/ActiveIndexMap.hpp>
+
+using namespace Opm;
+
+BOOST_AUTO_TEST_CASE(AllActive) {
+    ActiveIndexMap map(10);
+    BOOST_CHECK_EQUAL(map.globalSize(), 10U);
+    BOOST_CHECK_EQUAL(map.activeSize(), 10U);
+    BOOST_CHECK(map.allActive());
+    BOOST_CHECK(map == ActiveIndexMap(std::vector<int>(10, 1)));
+
+    for (std::size_t g = 0; g < 10; g++) {
+        BOOST_CHECK(map.isActive(g));
+        BOOST_CHECK_EQUAL(map.activeIndex(g), static_cast<int>(g));
+        BOOST_CHECK_EQUAL(map.globalIndex(g), static_cast<int>(g));
+    }
+    BOOST_CHECK_THROW(map.activeIndex(10), std::out_of_range);
+}
+
+
+BOOST_AUTO_TEST_CASE(Actnum) {
+    std::vector<int> actnum = {1, 0, 0, 1, 2, 0};
+    ActiveIndexMap map(actnum);
+
+    BOOST_CHECK_EQUAL(map.globalSize(), 6U);
+    BOOST_CHECK_EQUAL(map.activeSize(), 3U);
+    BOOST_CHECK(!map.allActive());
+    BOOST_CHECK(map != ActiveIndexMap(6));
+
+    BOOST_CHECK(map.globalToActive() == std::vector<int>({0, -1, -1, 1, 2, -1}));
+    BOOST_CHECK(map.activeToGlobal() == std::vector<int>({0, 3, 4}));
+    BOOST_CHECK(!map.isActive(1));
+    BOOST_CHECK_EQUAL(map.activeIndex(2), -1);
+    BOOST_CHECK_EQUAL(map.globalIndex(2), 4);
+    BOOST_CHECK_THROW(map.globalIndex(3), std::out_of_range);
+
+    std::vector<double> global = {0, 1, 2, 3, 4, 5};
+    std::vector<double> active = {10, 30, 40};
+    BOOST_CHECK(map.compress(global) == std::vector<double>({0, 3, 4}));
+    BOOST_CHECK(map.expand(active, -1.0) == std::vector<double>({10, -1, -1, 30, 40, -1}));
+
+    BOOST_CHECK_THROW(map.compress(active), std::invalid_argument);
+    BOOST_CHECK_THROW(map.expand(global), std::invalid_argument);
+}
+
+
+BOOST_AUTO_TEST_CASE(LargeCompressExpand) {
+    const std::size_t size = 500000;
+    std::vector<int> actnum(size);
+    for (std::size_t g = 0; g < size; g++)
+        actnum[g] = (g % 3 == 0) ? 0 : 1;
+
+    ActiveIndexMap map(actnum);
+    std::vector<long> global(size);
+    std::iota(global.begin(), global.end(), 0);
+
+    const auto active = map.compress(global);
+    BOOST_CHECK_EQUAL(active.size(), map.activeSize());
+    for (std::size_t a = 0; a < active.size(); a++)
+        BOOST_CHECK_EQUAL(active[a], map.globalIndex(a));
+
+    const auto expanded = map.expand(active, -1L);
+    for (std::size_t g = 0; g < size; g++)
+        BOOST_CHECK_EQUAL(expanded[g], map.isActive(g) ? static_cast<long>(g) : -1L);
+}
+
+
+BOOST_AUTO_TEST_CASE(LargeCompressExpandBool) {
+    const std::size_t size = 500000;
+    std::vector<int> actnum(size);
+    std::vector<bool> global(size);
+    for (std::size_t g = 0; g < size; g++) {
+        actnum[g] = (g % 3 == 0) ? 0 : 1;
+        global[g] = (g % 7 < 3);
+    }
+
+    ActiveIndexMap map(actnum);
+    const auto active = map.compress(global);
+    for (std::size_t a = 0; a < active.size(); a++)
+        BOOST_CHECK_EQUAL(active[a], global[map.globalIndex(a)]);
+
+    const auto expanded = map.expand(active, true);
+    for (std::size_t g = 0; g < size; g++)
+        BOOST_CHECK_EQUAL(expanded[g], map.isActive(g) ? global[g] : true);
+}
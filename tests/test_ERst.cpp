@@ -226,6 +226,114 @@ BOOST_AUTO_TEST_CASE(TestERst_3) {
     };
 }
 
+template <typename T>
+static std::vector<T> selectElements(const std::vector<int>& elements, const std::vector<T>& data)
+{
+    std::vector<T> result;
+    for (int e : elements)
+        result.push_back(data[e % data.size()]);
+
+    return result;
+}
+
+
+BOOST_AUTO_TEST_CASE(TestERst_partial) {
+
+    // arrays spanning several Fortran records / formatted blocks
+
+    for (const std::string& testFile : {std::string("TEST_PARTIAL.UNRST"), std::string("TEST_PARTIAL.FUNRST")}) {
+        {
+            EclOutput eclTest(testFile, testFile == "TEST_PARTIAL.FUNRST");
+
+            for (int seqnum = 1; seqnum <= 3; seqnum++) {
+                std::vector<int> inte(2345);
+                std::vector<float> real(2100);
+                std::vector<double> doub(3003);
+                std::vector<bool> logi(1001);
+                std::vector<std::string> chars(250);
+
+                for (size_t i = 0; i < inte.size(); i++) inte[i] = static_cast<int>(i) * seqnum - 1000;
+                for (size_t i = 0; i < real.size(); i++) real[i] = 0.5f * i + seqnum;
+                for (size_t i = 0; i < doub.size(); i++) doub[i] = -1.0 / (i + 1) * seqnum;
+                for (size_t i = 0; i < logi.size(); i++) logi[i] = (i + seqnum) % 3 == 0;
+                for (size_t i = 0; i < chars.size(); i++) chars[i] = "W" + std::to_string(i + seqnum);
+
+                eclTest.write("SEQNUM", std::vector<int>{seqnum});
+                eclTest.write("INTE", inte);
+                eclTest.write("REAL", real);
+                eclTest.write("DOUB", doub);
+                eclTest.write("LOGI", logi);
+                eclTest.write("CHARS", chars);
+            }
+        }
+
+        ERst ref(testFile);
+        ERst rst1(testFile);
+
+        const std::vector<int> elements = {2099, 0, 999, 1000, 1001, 17, 1000};
+
+        for (int seqnum : ref.listOfReportStepNumbers()) {
+            ref.loadReportStepNumber(seqnum);
+
+            std::vector<int> logiElements;
+            std::vector<int> charElements;
+            for (int e : elements) {
+                logiElements.push_back(e % 1001);
+                charElements.push_back(e % 250);
+            }
+
+            BOOST_CHECK(rst1.getRst<int>("INTE", seqnum, elements) == selectElements(elements, ref.getRst<int>("INTE", seqnum)));
+            BOOST_CHECK(rst1.getRst<float>("REAL", seqnum, elements) == selectElements(elements, ref.getRst<float>("REAL", seqnum)));
+            BOOST_CHECK(rst1.getRst<double>("DOUB", seqnum, elements) == selectElements(elements, ref.getRst<double>("DOUB", seqnum)));
+            BOOST_CHECK(rst1.getRst<bool>("LOGI", seqnum, logiElements) == selectElements(elements, ref.getRst<bool>("LOGI", seqnum)));
+            BOOST_CHECK(rst1.getRst<std::string>("CHARS", seqnum, charElements) == selectElements(elements, ref.getRst<std::string>("CHARS", seqnum)));
+
+            const auto& doub = ref.getRst<double>("DOUB", seqnum);
+            BOOST_CHECK(rst1.getRst<double>("DOUB", seqnum, 995, 1010) == std::vector<double>(doub.begin() + 995, doub.begin() + 2005));
+            BOOST_CHECK(rst1.getRst<double>("DOUB", seqnum, 0, 0).empty());
+        }
+
+        const auto series = rst1.getRstTimeSeries<int>("INTE", {5, 2344});
+        BOOST_CHECK_EQUAL(series.size(), 3U);
+        for (size_t i = 0; i < series.size(); i++) {
+            const int seqnum = static_cast<int>(i) + 1;
+            BOOST_CHECK(series[i] == std::vector<int>({5 * seqnum - 1000, 2344 * seqnum - 1000}));
+        }
+
+        BOOST_CHECK_THROW(rst1.getRst<int>("INTE", 1, {2345}), std::invalid_argument);
+        BOOST_CHECK_THROW(rst1.getRst<int>("INTE", 1, {-1}), std::invalid_argument);
+        BOOST_CHECK_THROW(rst1.getRst<float>("INTE", 1, {1}), std::runtime_error);
+        BOOST_CHECK_THROW(rst1.getRst<int>("INTE", 4, {1}), std::invalid_argument);
+        BOOST_CHECK_THROW(rst1.getRstTimeSeries<int>("NOSUCH", {1}), std::runtime_error);
+
+        if (remove(testFile.c_str()) == -1) {
+            std::cout << " > Warning! temporary file was not deleted" << std::endl;
+        };
+    }
+
+    // selected keywords of a report step
+
+    ERst rst2("SPE1_TESTCASE.UNRST");
+    ERst ref("SPE1_TESTCASE.UNRST");
+
+    rst2.loadReportStepNumber(25, {"PRESSURE", "SWAT"});
+    ref.loadReportStepNumber(25);
+
+    BOOST_CHECK(rst2.getRst<float>("PRESSURE", 25) == ref.getRst<float>("PRESSURE", 25));
+    BOOST_CHECK(rst2.getRst<int>("ICON", 25) == ref.getRst<int>("ICON", 25));
+    BOOST_CHECK_THROW(rst2.loadReportStepNumber(25, {"NOSUCH"}), std::runtime_error);
+
+    const auto pressure = rst2.getRstTimeSeries<float>("PRESSURE", {0, 299});
+    const auto& steps = ref.listOfReportStepNumbers();
+    BOOST_CHECK_EQUAL(pressure.size(), steps.size());
+
+    for (size_t i = 0; i < steps.size(); i++) {
+        ref.loadReportStepNumber(steps[i]);
+        const auto& p = ref.getRst<float>("PRESSURE", steps[i]);
+        BOOST_CHECK(pressure[i] == std::vector<float>({p[0], p[299]}));
+    }
+}
+
 // ====================================================================
 
 class RSet
@@ -44,6 +44,42 @@ BOOST_AUTO_TEST_CASE(deviation) {
 
 
 
+BOOST_AUTO_TEST_CASE(exceedingDeviations) {
+    const double absTol = 1.0e-3;
+    const double relTol = 1.0e-2;
+
+    std::vector<double> v1 = {1.0, 0.0, 0.0,  5.0,   100.0, -1.0,    -1.0e-4, 2.0};
+    std::vector<double> v2 = {1.0, 0.0, 0.5,  5.001, 101.5,  1.0,     0.0,    -2.0};
+
+    auto indices = ECLFilesComparator::exceedingDeviations(v1, v2, absTol, relTol, true);
+    BOOST_CHECK(indices == std::vector<size_t>({2, 4}));
+
+    indices = ECLFilesComparator::exceedingDeviations(v1, v2, absTol, relTol, false);
+    BOOST_CHECK(indices == std::vector<size_t>({2, 4, 5, 7}));
+
+    // the same indices as an element by element test with calculateDeviations()
+
+    const size_t size = 250000;
+    std::vector<float> t1(size), t2(size);
+    for (size_t i = 0; i < size; i++) {
+        t1[i] = 1.0f + (i % 97);
+        t2[i] = t1[i] * (1.0f + ((i % 13) - 6) * 2.0e-3f);
+    }
+
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < size; i++) {
+        Deviation dev = ECLFilesComparator::calculateDeviations(t1[i], t2[i]);
+        if (dev.abs > absTol && (dev.rel > relTol || dev.rel == -1)) {
+            expected.push_back(i);
+        }
+    }
+
+    BOOST_CHECK(!expected.empty());
+    BOOST_CHECK(ECLFilesComparator::exceedingDeviations(t1, t2, absTol, relTol, true) == expected);
+}
+
+
+
 BOOST_AUTO_TEST_CASE(median) {
     std::vector<double> vec = {1,3,4,5};
 
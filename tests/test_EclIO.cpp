@@ -252,6 +252,167 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted_values) {
+
+    std::string testFile="TEST.FDAT";
+
+    {
+        EclOutput eclTest(testFile, true);
+
+        eclTest.write("INTE", std::vector<int>{0, -17, 2147483647, -2147483647 - 1});
+        eclTest.write("REAL", std::vector<float>{0.0f, -1.5f, 123.45f, 1.0e-30f});
+        eclTest.write("DOUB", std::vector<double>{0.0, -0.125, 1.0e100, 3.0e-101});
+    }
+
+    std::ifstream file(testFile);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    std::string expected =
+        " 'INTE    '           4 'INTE'\n"
+        "           0         -17  2147483647 -2147483648\n"
+        " 'REAL    '           4 'REAL'\n"
+        "   0.00000000E+00  -0.15000000E+01   0.12345000E+03   0.10000000E-29\n"
+        " 'DOUB    '           4 'DOUB'\n"
+        "   0.00000000000000D+00  -0.12500000000000D+00   0.10000000000000+101\n"
+        "   0.30000000000000-100\n";
+
+    BOOST_CHECK_EQUAL(content, expected);
+
+    if (remove(testFile.c_str())==-1) {
+        std::cout << " > Warning! temporary file was not deleted" << std::endl;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_formatted_values) {
+
+    std::string testFile="TEST.FDAT";
+
+    std::vector<int> inte;
+    std::vector<float> real;
+    std::vector<double> doub;
+
+    for (int i = 0; i < 5000; i++) {
+        inte.push_back(i % 2 == 0 ? -i * 4099 : i * 7);
+        real.push_back(static_cast<float>(std::pow(-1.1, i % 300)) / (i + 1));
+        doub.push_back(std::pow(-1.3, i % 1000) / (i + 3));
+    }
+
+    {
+        EclOutput eclTest(testFile, true);
+
+        eclTest.write("INTE", inte);
+        eclTest.write("REAL", real);
+        eclTest.write("DOUB", doub);
+    }
+
+    // The values read must be identical to std::stod() of the text in the file.
+
+    std::vector<double> expectReal;
+    std::vector<double> expectDoub;
+    {
+        std::ifstream file(testFile);
+        std::string token;
+        int arrayIndex = -1;
+
+        while (file >> token) {
+            if (token == "'INTE" || token == "'REAL" || token == "'DOUB") {
+                arrayIndex++;
+                file >> token >> token >> token;
+            } else if (arrayIndex == 1) {
+                expectReal.push_back(std::stod(token));
+            } else if (arrayIndex == 2) {
+                auto p = token.find_first_of("D");
+                if (p == std::string::npos) {
+                    p = token.find_first_of("+-", 1);
+                    token.insert(p, "E");
+                } else {
+                    token[p] = 'E';
+                }
+
+                expectDoub.push_back(std::stod(token));
+            }
+        }
+    }
+
+    EclFile file1(testFile);
+
+    BOOST_CHECK(file1.get<int>("INTE") == inte);
+
+    const auto& real1 = file1.get<float>("REAL");
+    const auto& doub1 = file1.get<double>("DOUB");
+
+    BOOST_CHECK_EQUAL(expectReal.size(), real1.size());
+    BOOST_CHECK_EQUAL(expectDoub.size(), doub1.size());
+
+    for (size_t i = 0; i < real1.size(); i++) {
+        BOOST_CHECK_EQUAL(real1[i], static_cast<float>(expectReal[i]));
+    }
+
+    for (size_t i = 0; i < doub1.size(); i++) {
+        BOOST_CHECK_EQUAL(doub1[i], expectDoub[i]);
+    }
+
+    if (remove(testFile.c_str())==-1) {
+        std::cout << " > Warning! temporary file was not deleted" << std::endl;
+    };
+
+    // Values which are not aligned in the standard columns, the lines must
+    // still have the standard length.
+
+    auto line = [](const std::string& values, size_t length)
+                {
+                    return values + std::string(length - values.size(), ' ') + "\n";
+                };
+
+    {
+        std::ofstream file(testFile);
+        file << " 'INTE    '           5 'INTE'\n"
+             << line("1 -2 3\t4 5", 60)
+             << " 'REAL    '           3 'REAL'\n"
+             << line("  0.25 -1.5E+02 3.0E-01", 51)
+             << " 'DOUB    '           4 'DOUB'\n"
+             << line("  0.5D+01 0.25-01 -0.125+003", 69)
+             << line(" 1.0D-1", 23)
+             << " 'LOGI    '           3 'LOGI'\n"
+             << line(" T F T", 9)
+             << " 'CHAR    '           3 'CHAR'\n"
+             << line("'A       ' 'BB      '  'C C     '", 33);
+    }
+
+    EclFile file2(testFile);
+
+    BOOST_CHECK(file2.get<int>("INTE") == std::vector<int>({1, -2, 3, 4, 5}));
+    BOOST_CHECK(file2.get<float>("REAL") == std::vector<float>({0.25f, -150.0f, 0.3f}));
+    BOOST_CHECK(file2.get<double>("DOUB") == std::vector<double>({5.0, 0.025, -125.0, 0.1}));
+    BOOST_CHECK(file2.get<bool>("LOGI") == std::vector<bool>({true, false, true}));
+    BOOST_CHECK(file2.get<std::string>("CHAR") == std::vector<std::string>({"A", "BB", "C C"}));
+
+    if (remove(testFile.c_str())==-1) {
+        std::cout << " > Warning! temporary file was not deleted" << std::endl;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_unloadData) {
+
+    EclFile file1("ECLFILE.INIT");
+
+    std::vector<float> porv = file1.get<float>("PORV");
+    BOOST_CHECK_EQUAL(porv.size(), 3146);
+
+    // unloaded arrays are loaded again on demand
+
+    file1.unloadData("PORV");
+    BOOST_CHECK(file1.get<float>("PORV") == porv);
+
+    file1.unloadData(2);
+    BOOST_CHECK(file1.get<float>(2) == porv);
+
+    file1.loadData();
+    file1.clearData();
+    BOOST_CHECK_EQUAL(file1.get<int>("ICON").size(), 1875);
+    BOOST_CHECK(file1.get<float>("PORV") == porv);
+}
+
 BOOST_AUTO_TEST_CASE(TestEcl_getList) {
 
     std::string inputFile="ECLFILE.INIT";
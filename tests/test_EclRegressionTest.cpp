@@ -580,6 +580,65 @@ BOOST_AUTO_TEST_CASE(results_init_2) {
     };
 }
 
+BOOST_AUTO_TEST_CASE(results_init_3) {
+
+    // ---------------------------------------------------------------------------
+    // generated case with large arrays, compared without throwing on errors
+
+    const size_t nCells = 200000;
+
+    std::vector<float> multx1(nCells), multx2(nCells);
+    std::vector<float> swat1(nCells, 0.25), swat2(nCells, 0.25);
+    std::vector<int> fipnum(nCells);
+
+    for (size_t i = 0; i < nCells; i++) {
+        multx1[i] = 100.0 + (i % 1000);
+        multx2[i] = multx1[i] * (1.0 + 1.0e-4);
+        fipnum[i] = 1 + i / 1000;
+    }
+
+    // three cells exceeding both absolute and relative tolerances
+    multx2[17] *= 1.01;
+    multx2[123456] *= 0.99;
+    multx2[nCells - 1] = 0.0;
+
+    // small negative values are accepted for SWAT, large negative values are not
+    swat1[1000] = -1.0e-5;
+    swat2[1000] = 0.0;
+    swat1[2000] = -0.5;
+    swat2[2000] = -0.5;
+
+    std::vector<std::string> floatKeys = {"MULTX", "SWAT"};
+    std::vector<std::string> intKeys = {"FIPNUM"};
+
+    makeInitFile("TMP1.INIT", floatKeys, {multx1, swat1}, intKeys, {fipnum});
+    makeInitFile("TMP2.INIT", floatKeys, {multx2, swat2}, intKeys, {fipnum});
+
+    ECLRegressionTest test1("TMP1", "TMP2", 1e-3, 1e-3);
+    BOOST_CHECK_THROW(test1.results_init(), std::runtime_error);
+
+    ECLRegressionTest test2("TMP1", "TMP2", 1e-3, 1e-3);
+    test2.throwOnErrors(false);
+    test2.results_init();
+
+    // three MULTX deviations, and the negative SWAT value in both cases
+    BOOST_CHECK_EQUAL(test2.getNoErrors(), 5U);
+
+    ECLRegressionTest test3("TMP1", "TMP2", 1e-3, 1e-3);
+    test3.throwOnErrors(false);
+    test3.doAnalysis(true);
+    test3.results_init();
+    BOOST_CHECK_EQUAL(test3.countDev(), 1);
+
+    if (remove("TMP1.INIT")==-1) {
+        std::cout << " > Warning! temporary file was not deleted" << std::endl;
+    }
+
+    if (remove("TMP2.INIT")==-1) {
+        std::cout << " > Warning! temporary file was not deleted" << std::endl;
+    };
+}
+
 BOOST_AUTO_TEST_CASE(results_unrst_1) {
     using Date = std::tuple<int, int, int>;
 
@@ -1236,6 +1236,38 @@ BOOST_AUTO_TEST_CASE(BLOCK_VARIABLES) {
 }
 
 
+BOOST_AUTO_TEST_CASE(BLOCK_VARIABLES_ARRAY) {
+    setup cfg( "block_array" );
+
+    out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+    const auto& requests = writer.block_requests();
+    BOOST_CHECK( requests.size() > 10 );
+
+    std::map<std::pair<std::string, int>, double> block_map;
+    std::vector<double> block_array;
+    for (const auto& request : requests) {
+        BOOST_CHECK_EQUAL( request.active_index, cfg.grid.activeIndex( request.global_index ));
+
+        const double value = 0.5 + block_array.size();
+        block_array.push_back( value );
+        block_map[std::make_pair(request.keyword, request.global_index + 1)] = value;
+    }
+
+    SummaryState map_state, array_state;
+    writer.eval( map_state, 1, 1 * day, cfg.es, cfg.schedule, cfg.wells, {}, {}, block_map );
+    writer.eval_blocks( array_state, 1, 1 * day, cfg.es, cfg.schedule, cfg.wells, {}, {}, block_array );
+
+    for (const auto& key : { "BPR:1,1,1", "BPR:1,1,3", "BSWAT:1,1,1", "BWPC:1,2,1", "BOVIS:1,1,1" }) {
+        BOOST_CHECK( array_state.has( key ));
+        BOOST_CHECK_EQUAL( map_state.get( key ), array_state.get( key ));
+    }
+
+    block_array.pop_back();
+    BOOST_CHECK_THROW( writer.eval_blocks( array_state, 1, 1 * day, cfg.es, cfg.schedule, cfg.wells, {}, {}, block_array ),
+                       std::invalid_argument );
+}
+
+
 
 /*
   The SummaryConfig.require3DField( ) implementation is slightly ugly:
@@ -32,6 +32,7 @@
 #include <fstream>
 #include <initializer_list>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include <ert/ecl/ecl_kw_magic.h>
@@ -1378,6 +1379,83 @@ BOOST_AUTO_TEST_CASE (Oil_Water_Family_Two)
     }
 }
 
+BOOST_AUTO_TEST_CASE (Oil_Water_Many_Regions)
+{
+    // Enough tables that the tables are built in parallel.
+    const auto numTables = std::size_t{100};
+
+    auto input = std::string { R"(
+RUNSPEC
+WATER
+OIL
+
+METRIC
+
+DIMENS
+  1 1 1 /
+
+TABDIMS
+  100 /
+
+GRID
+
+DXV
+  1 /
+
+DYV
+  1 /
+
+DZV
+  0.1 /
+
+DEPTHZ
+  4*2000.0 /
+
+PORO
+  0.3 /
+
+PROPS
+
+SWOF
+)" };
+
+    for (auto t = 0*numTables; t < numTables; ++t) {
+        input += "  0.2  0.0  1.0  " + std::to_string(t) + "\n"
+                 "  0.6  0.3  0.2  0.0\n"
+                 "  1.0  1.0  0.0  0.0 /\n";
+    }
+
+    const auto es = Opm::EclipseState { Opm::Parser{}.parseString(input) };
+
+    auto tables = Opm::Tables{ es.getUnits() };
+    tables.addSatFunc(es);
+
+    const auto& tabdims = tables.tabdims();
+    const auto& tab     = tables.tab();
+
+    const auto ibswfn = tabdims[ TABDIMS_IBSWFN_OFFSET_ITEM ] - 1;
+    const auto nsswfn = tabdims[ TABDIMS_NSSWFN_ITEM ];
+    const auto ntswfn = tabdims[ TABDIMS_NTSWFN_ITEM ];
+
+    BOOST_CHECK_EQUAL(ntswfn, numTables);
+
+    // Columns [ Sw, Krw, Pcow, dKrw/dSw, dPcow/dSw ], each column holds
+    // all tables.
+    const auto value = [&](const std::size_t table, const std::size_t row, const std::size_t col)
+    {
+        return tab[ ibswfn + row + nsswfn*(table + ntswfn*col) ];
+    };
+
+    for (auto t = 0*numTables; t < numTables; ++t) {
+        BOOST_CHECK_CLOSE(value(t, 1, 0), 0.6, 1.0e-10);
+        BOOST_CHECK_CLOSE(value(t, 2, 1), 1.0, 1.0e-10);
+        BOOST_CHECK_CLOSE(value(t, 1, 3), 0.3 / 0.4, 1.0e-10);
+        BOOST_CHECK_CLOSE(value(t, 2, 3), 0.7 / 0.4, 1.0e-10);
+        BOOST_CHECK_CLOSE(value(t, 1, 4), -static_cast<double>(t) / 0.4, 1.0e-10);
+        BOOST_CHECK_CLOSE(value(t, 3, 0), 1.0e20, 1.0e-10);
+    }
+}
+
 BOOST_AUTO_TEST_CASE (Gas_Oil_Familiy_One)
 {
     const auto es = SPE9::TwoPhase::GasOil::satfuncTables();
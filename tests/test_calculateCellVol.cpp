@@ -24,8 +24,12 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/floating_point_comparison.hpp>
 
+#include <numeric>
+#include <stdexcept>
+
 /* --- our own headers --- */
 #include <opm/common/utility/numeric/calculateCellVol.hpp>
+#include <opm/common/utility/numeric/calculateCellGeometry.hpp>
 
 
 
@@ -60,4 +64,55 @@ BOOST_AUTO_TEST_CASE (calc_cellvol)
     BOOST_REQUIRE_CLOSE (calculateCellVol(x4,y4,z4), 23391.4917234564, 1e-9);
 }
 
+BOOST_AUTO_TEST_CASE (calc_cell_geometry)
+{
+    const std::size_t nx = 3, ny = 2, nz = 2;
+    std::vector<double> coord;
+    std::vector<double> zcorn(8 * nx * ny * nz);
+
+    /* Slightly tilted pillars and an irregular ZCORN. */
+    for (std::size_t j = 0; j <= ny; j++) {
+        for (std::size_t i = 0; i <= nx; i++) {
+            const double x = 100.0 * i + 3.0 * j;
+            const double y = 50.0 * j + 2.0 * i * j;
+            coord.insert(coord.end(), {x, y, 0.0, x + 0.1 * (i + j), y + 0.2 * i, 100.0});
+        }
+    }
+
+    for (std::size_t k = 0; k < 2*nz; k++)
+        for (std::size_t j = 0; j < 2*ny; j++)
+            for (std::size_t i = 0; i < 2*nx; i++)
+                zcorn[i + j * 2 * nx + k * 4 * nx * ny] = 10.0 + 5.0 * ((k + 1) / 2) + 0.3 * ((i + 1) / 2) + 0.2 * ((j + 1) / 2) * (k + 1);
+
+    BOOST_CHECK_THROW(Opm::calculateCellGeometry(nx + 1, ny, nz, coord, zcorn), std::invalid_argument);
+    const auto geometry = Opm::calculateCellGeometry(nx, ny, nz, coord, zcorn);
+    BOOST_CHECK_EQUAL(geometry.volume.size(), nx * ny * nz);
+    BOOST_CHECK(Opm::calculateCellVolumes(nx, ny, nz, coord, zcorn) == geometry.volume);
+    const auto depth = Opm::calculateCellDepths(nx, ny, nz, zcorn);
+
+    for (std::size_t k = 0; k < nz; k++) {
+        for (std::size_t j = 0; j < ny; j++) {
+            for (std::size_t i = 0; i < nx; i++) {
+                std::vector<double> x(8), y(8), z(8);
+                for (std::size_t c = 0; c < 8; c++) {
+                    const std::size_t ic = c & 1, jc = (c >> 1) & 1, kc = c >> 2;
+                    const double* pillar = &coord[6 * ((i + ic) + (j + jc) * (nx + 1))];
+                    z[c] = zcorn[(2*i + ic) + (2*j + jc) * 2 * nx + (2*k + kc) * 4 * nx * ny];
+                    const double t = (z[c] - pillar[2]) / (pillar[5] - pillar[2]);
+                    x[c] = pillar[0] + t * (pillar[3] - pillar[0]);
+                    y[c] = pillar[1] + t * (pillar[4] - pillar[1]);
+                }
+
+                const std::size_t g = i + j * nx + k * nx * ny;
+                BOOST_CHECK_CLOSE(geometry.volume[g], calculateCellVol(x, y, z), 1e-9);
+                BOOST_CHECK_CLOSE(geometry.center_x[g], std::accumulate(x.begin(), x.end(), 0.0) / 8, 1e-9);
+                BOOST_CHECK_CLOSE(geometry.center_y[g], std::accumulate(y.begin(), y.end(), 0.0) / 8, 1e-9);
+                BOOST_CHECK_CLOSE(geometry.depth[g], std::accumulate(z.begin(), z.end(), 0.0) / 8, 1e-9);
+                BOOST_CHECK_CLOSE(depth[g], geometry.depth[g], 1e-9);
+                BOOST_CHECK_CLOSE(geometry.thickness[g], (z[4] + z[5] + z[6] + z[7] - z[0] - z[1] - z[2] - z[3]) / 4, 1e-9);
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
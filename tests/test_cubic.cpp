@@ -42,6 +42,9 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/floating_point_comparison.hpp>
 
+#include <cmath>
+#include <vector>
+
 /* --- our own headers --- */
 #include <opm/common/utility/numeric/MonotCubicInterpolator.hpp>
 using namespace Opm;
@@ -65,4 +68,90 @@ BOOST_AUTO_TEST_CASE (cubic)
     BOOST_REQUIRE_CLOSE (interp.evaluate(4.0), 2., 0.00001);
 }
 
+BOOST_AUTO_TEST_CASE (cubic_batch)
+{
+    std::vector<double> x, f;
+    for (int i = 0; i < 40; ++i) {
+        x.push_back(0.1 * i * i);
+        f.push_back((i < 20) ? std::sqrt(1.0 * i) : 4.5 + 0.01 * (i / 5));
+    }
+    x.push_back(200.0);
+    f.push_back(3.0);
+
+    std::vector<double> xs;
+    for (int i = -100; i < 2200; ++i) {
+        xs.push_back(0.075 * i);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        xs.push_back(250.0 * std::sin(1.3 * i));
+    }
+    xs.insert(xs.end(), x.begin(), x.end());
+
+    MonotCubicInterpolator interp(x, f);
+    MonotCubicInterpolator monotone(std::vector<double>(x.begin(), x.end() - 1),
+                                    std::vector<double>(f.begin(), f.end() - 1));
+    MonotCubicInterpolator linear(monotone);
+    linear.shrinkFlatAreas(1e-3);
+
+    for (const auto* object : {&interp, &monotone, &linear}) {
+        std::vector<double> out(xs.size());
+        object->evaluate(xs.data(), out.data(), xs.size());
+        for (size_t i = 0; i < xs.size(); ++i) {
+            BOOST_CHECK_EQUAL(out[i], object->evaluate(xs[i]));
+        }
+    }
+
+    const double nan = std::nan("");
+    double out;
+    BOOST_CHECK_THROW(interp.evaluate(&nan, &out, 1), const char*);
+}
+
+BOOST_AUTO_TEST_CASE (cubic_reference_values)
+{
+    std::vector<double> x, f;
+    for (int i = 0; i < 40; ++i) {
+        x.push_back(0.1 * i * i);
+        f.push_back((i < 20) ? std::sqrt(1.0 * i) : 4.5 + 0.01 * (i / 5));
+    }
+    x.push_back(200.0);
+    f.push_back(3.0);
+
+    MonotCubicInterpolator interp(x, f);
+    MonotCubicInterpolator monotone(std::vector<double>(x.begin(), x.end() - 1),
+                                    std::vector<double>(f.begin(), f.end() - 1));
+    MonotCubicInterpolator linear(monotone);
+    linear.shrinkFlatAreas(1e-3);
+
+    // Reference values computed with the std::map based evaluate() which
+    // was used before the flat arrays, printed with 17 significant digits.
+    const std::vector<double> xs = {-1.0, 0.0, 0.05, 0.1, 0.37, 1.6, 2.5, 3.6, 7.0, 10.0, 16.9, 25.0,
+                                    36.1, 40.0, 57.6, 90.0, 100.0, 120.0, 144.4, 152.1, 170.0, 199.0, 200.0, 250.0};
+    const std::vector<std::vector<double>> expected = {
+        {0, 0, 0.55387055078389391, 1, 1.3934804493229596, 2, 2.2360679774997898, 2.4494897427831779,
+         2.8926652485775737, 3.1622776601683795, 3.6055512754639891, 3.9763337668577932, 4.358898943540674,
+         4.54, 4.54, 4.5599999999999996, 4.5599999999999996, 4.5666949155122083, 4.5700000000000003,
+         4.5700000000000012, 4.0983676228834609, 3.0331116111292329, 3, 3},
+        {0, 0, 0.5740173265117483, 1, 1.3960678935382849, 2, 2.2360679774997898, 2.4494897427831779,
+         2.8926652485775737, 3.1622776601683795, 3.6055512754639891, 3.9763337668577932, 4.358898943540674,
+         4.54, 4.54, 4.5599999999999996, 4.5599999999999996, 4.5670130194302132, 4.5700000000000003,
+         4.5700000000000003, 4.5700000000000003, 4.5700000000000003, 4.5700000000000003, 4.5700000000000003},
+        {0, 0, 0.5, 1, 1.3727922061357856, 2, 2.2360679774997898, 2.4494897427831779,
+         2.8889822571887112, 3.1622776601683795, 3.6055512754639891, 3.9754161315240162, 4.358898943540674,
+         4.54, 4.547822222222222, 4.5599999999999996, 4.563076923076923, 4.5692307692307699, 4.5700000000000003,
+         4.5700000000000003, 4.5700000000000003, 4.5700000000000003, 4.5700000000000003, 4.5700000000000003}
+    };
+
+    // The tolerance is in percent, i.e. a relative difference of 1e-12.
+    const double tolerance = 1e-10;
+    const MonotCubicInterpolator* objects[] = {&interp, &monotone, &linear};
+    for (size_t o = 0; o < 3; ++o) {
+        std::vector<double> out(xs.size());
+        objects[o]->evaluate(xs.data(), out.data(), xs.size());
+        for (size_t i = 0; i < xs.size(); ++i) {
+            BOOST_CHECK_CLOSE(objects[o]->evaluate(xs[i]), expected[o][i], tolerance);
+            BOOST_CHECK_CLOSE(out[i], expected[o][i], tolerance);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
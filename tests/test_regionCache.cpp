@@ -22,6 +22,7 @@
 #define BOOST_TEST_MODULE RegionCache
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 
 #include <opm/parser/eclipse/Deck/Deck.hpp>
@@ -45,19 +46,86 @@ BOOST_AUTO_TEST_CASE(create) {
     const EclipseGrid& grid = es.getInputGrid();
     Schedule schedule( deck, es);
     out::RegionCache rc(es.get3DProperties() , grid, schedule);
+    rc.update( schedule, schedule.size() - 1 );
 
     {
-        const auto& empty = rc.connections( 4 );
-        BOOST_CHECK_EQUAL( empty.size() , 0 );
+        const auto empty = rc.region_range( 4 );
+        BOOST_CHECK_EQUAL( empty.second - empty.first , 0 );
     }
 
     {
-        const auto& top_layer = rc.connections( 1 );
-        BOOST_CHECK_EQUAL( top_layer.size() , 3 );
+        const auto top_layer = rc.region_range( 1 );
+        BOOST_CHECK_EQUAL( top_layer.second - top_layer.first , 3 );
         {
-            auto pair = top_layer[0];
-            BOOST_CHECK_EQUAL( pair.first , "W_1");
-            BOOST_CHECK_EQUAL( pair.second , grid.activeIndex( 0,0,0));
+            const auto& conn = rc.connection( top_layer.first );
+            BOOST_CHECK_EQUAL( rc.wells()[ conn.well ] , "W_1");
+            BOOST_CHECK_EQUAL( conn.active_index , grid.activeIndex( 0,0,0));
         }
     }
 }
+
+
+BOOST_AUTO_TEST_CASE(region_layout) {
+    Parser parser;
+    Deck deck( parser.parseFile( path ));
+    EclipseState es(deck);
+    const EclipseGrid& grid = es.getInputGrid();
+    Schedule schedule( deck, es);
+    out::RegionCache rc(es.get3DProperties() , grid, schedule);
+
+    BOOST_CHECK( rc.update( schedule, 0 ));
+    BOOST_CHECK( !rc.update( schedule, 0 ));
+    BOOST_CHECK( !rc.update( schedule, 1 ));
+    BOOST_CHECK_EQUAL( rc.wells().size(), 5 );
+
+    {
+        const auto empty = rc.region_range( 4 );
+        BOOST_CHECK_EQUAL( empty.first , empty.second );
+        const auto outside = rc.region_range( 100 );
+        BOOST_CHECK_EQUAL( outside.first , outside.second );
+    }
+
+    {
+        const auto top_layer = rc.region_range( 1 );
+        BOOST_CHECK_EQUAL( top_layer.second - top_layer.first , 3 );
+
+        const auto& conn = rc.connection( top_layer.first );
+        BOOST_CHECK_EQUAL( rc.wells()[ conn.well ] , "W_1");
+        BOOST_CHECK_EQUAL( conn.connection , 0 );
+        BOOST_CHECK_EQUAL( conn.active_index , grid.activeIndex( 0,0,0));
+    }
+
+    /* W_2 has connections in regions 1 and 2, W_6 in region 2. */
+    data::Wells wells;
+    {
+        auto& w2 = wells["W_2"];
+        w2.connections.resize( 2 );
+        w2.connections[0].index = grid.activeIndex( 1,0,0 );
+        w2.connections[0].rates.set( data::Rates::opt::oil, -2.0 );
+        w2.connections[1].index = grid.activeIndex( 1,0,1 );
+        w2.connections[1].rates.set( data::Rates::opt::oil, -3.0 ).set( data::Rates::opt::wat, 0.5 );
+
+        auto& w6 = wells["W_6"];
+        w6.connections.resize( 1 );
+        w6.connections[0].index = grid.activeIndex( 7,7,1 );
+        w6.connections[0].rates.set( data::Rates::opt::gas, 10.0 );
+    }
+
+    std::vector<double> efac( rc.wells().size(), 1.0 );
+    efac[ std::find( rc.wells().begin(), rc.wells().end(), "W_2" ) - rc.wells().begin() ] = 0.5;
+    rc.update_rates( wells, efac );
+    BOOST_CHECK_EQUAL( rc.rate( 1, data::Rates::opt::oil, false ), -1.0 );
+    BOOST_CHECK_EQUAL( rc.rate( 1, data::Rates::opt::oil, true ), 0.0 );
+    BOOST_CHECK_EQUAL( rc.rate( 2, data::Rates::opt::oil, false ), -1.5 );
+    BOOST_CHECK_EQUAL( rc.rate( 2, data::Rates::opt::wat, true ), 0.25 );
+    BOOST_CHECK_EQUAL( rc.rate( 2, data::Rates::opt::gas, true ), 10.0 );
+    BOOST_CHECK_EQUAL( rc.rate( 4, data::Rates::opt::gas, true ), 0.0 );
+    BOOST_CHECK_THROW( rc.update_rates( wells, {} ), std::invalid_argument );
+
+    /* W_4 is added at report step 2. */
+    BOOST_CHECK( rc.update( schedule, 2 ));
+    BOOST_CHECK_EQUAL( rc.wells().size(), 6 );
+    const auto layer3 = rc.region_range( 3 );
+    BOOST_CHECK_EQUAL( layer3.second - layer3.first , 1 );
+    BOOST_CHECK_EQUAL( rc.wells()[ rc.connection( layer3.first ).well ] , "W_4");
+}